@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Minimal benchmark harness. Benchmarks register themselves with LM_BENCHMARK and report
+// results as CSV rows on stdout so runs can be diffed or fed into a spreadsheet.
+namespace Limitless::Bench {
+
+    using BenchmarkFn = void(*)();
+
+    struct BenchmarkInfo {
+        const char* name;
+        BenchmarkFn function;
+    };
+
+    inline std::vector<BenchmarkInfo>& GetRegistry() {
+        static std::vector<BenchmarkInfo> registry;
+        return registry;
+    }
+
+    struct Registrar {
+        Registrar(const char* name, BenchmarkFn fn) { GetRegistry().push_back({ name, fn }); }
+    };
+
+    // Emit one result row: benchmark,variant,threads,metric,value
+    inline void Report(const char* benchmark, const std::string& variant, uint32_t threads,
+                       const char* metric, double value) {
+        std::printf("%s,%s,%u,%s,%.2f\n", benchmark, variant.c_str(), threads, metric, value);
+        std::fflush(stdout);
+    }
+
+    // Run body(threadIndex) on threadCount threads released together; returns wall time in seconds.
+    inline double RunThreads(uint32_t threadCount, const std::function<void(uint32_t)>& body) {
+        std::atomic<uint32_t> ready{ 0 };
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (uint32_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t]() {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+                body(t);
+            });
+        }
+        while (ready.load() != threadCount)
+            std::this_thread::yield();
+
+        auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& thread : threads)
+            thread.join();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Thread counts swept by the contention benchmarks
+    inline const std::vector<uint32_t>& GetThreadCounts() {
+        static const std::vector<uint32_t> counts{ 1, 2, 4, 8, 16, 32 };
+        return counts;
+    }
+}
+
+#define LM_BENCHMARK(name)                                                              \
+    static void name();                                                                 \
+    static ::Limitless::Bench::Registrar name##_Registrar(#name, &name);                \
+    static void name()
@@ -0,0 +1,91 @@
+#include "Benchmark.h"
+#include "Core/Concurrency/LockFreeQueue.h"
+
+#include <deque>
+#include <mutex>
+#include <optional>
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr uint32_t OpsPerThread = 200000;
+    constexpr size_t QueueSize = 4096;
+    constexpr size_t BulkSize = 16;
+
+    // Baseline the lock-free queue is measured against
+    class MutexDequeQueue {
+    public:
+        bool TryPush(uint64_t&& item) {
+            std::scoped_lock lock(m_Mutex);
+            if (m_Items.size() >= QueueSize)
+                return false;
+            m_Items.push_back(item);
+            return true;
+        }
+
+        std::optional<uint64_t> TryPop() {
+            std::scoped_lock lock(m_Mutex);
+            if (m_Items.empty())
+                return std::nullopt;
+            uint64_t item = m_Items.front();
+            m_Items.pop_front();
+            return item;
+        }
+
+    private:
+        std::mutex m_Mutex;
+        std::deque<uint64_t> m_Items;
+    };
+
+    // Every thread alternates push/pop so each thread count is a balanced producer/consumer mix
+    template<typename Queue>
+    double MeasureSingle(uint32_t threads) {
+        Queue queue;
+        double seconds = Bench::RunThreads(threads, [&queue](uint32_t t) {
+            for (uint32_t i = 0; i < OpsPerThread; ++i) {
+                uint64_t value = (static_cast<uint64_t>(t) << 32) | i;
+                while (!queue.TryPush(std::move(value)))
+                    std::this_thread::yield();
+                while (!queue.TryPop())
+                    std::this_thread::yield();
+            }
+        });
+        return 2.0 * OpsPerThread * threads / seconds;
+    }
+
+    double MeasureBulk(uint32_t threads) {
+        Concurrency::LockFreeMPMCQueue<uint64_t, QueueSize> queue;
+        double seconds = Bench::RunThreads(threads, [&queue](uint32_t t) {
+            uint64_t batch[BulkSize];
+            for (uint32_t i = 0; i < OpsPerThread; i += BulkSize) {
+                for (size_t b = 0; b < BulkSize; ++b)
+                    batch[b] = (static_cast<uint64_t>(t) << 32) | (i + b);
+
+                size_t pushed = 0;
+                while (pushed < BulkSize) {
+                    pushed += queue.TryPushBulk(batch + pushed, BulkSize - pushed);
+                    if (pushed < BulkSize)
+                        std::this_thread::yield();
+                }
+                size_t popped = 0;
+                while (popped < BulkSize) {
+                    popped += queue.TryPopBulk(batch + popped, BulkSize - popped);
+                    if (popped < BulkSize)
+                        std::this_thread::yield();
+                }
+            }
+        });
+        return 2.0 * OpsPerThread * threads / seconds;
+    }
+}
+
+LM_BENCHMARK(MPMCQueueContention)
+{
+    for (uint32_t threads : Bench::GetThreadCounts()) {
+        Bench::Report("MPMCQueueContention", "mutex_deque", threads, "ops_per_sec", MeasureSingle<MutexDequeQueue>(threads));
+        Bench::Report("MPMCQueueContention", "lockfree_mpmc", threads, "ops_per_sec",
+                      MeasureSingle<Concurrency::LockFreeMPMCQueue<uint64_t, QueueSize>>(threads));
+        Bench::Report("MPMCQueueContention", "lockfree_mpmc_bulk16", threads, "ops_per_sec", MeasureBulk(threads));
+    }
+}
@@ -0,0 +1,58 @@
+#include "Benchmark.h"
+#include "Core/Concurrency/LockFreeQueue.h"
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr uint32_t Bursts = 200;
+    constexpr uint32_t BurstSize = 4096; // Several thousand jobs per worker per frame
+
+    struct Result {
+        double opsPerSec;
+        bool lostItems;
+    };
+
+    // Thread 0 owns the deque: it pushes a burst, then pops it back down while everyone else steals.
+    // Starts from a small ring so the growth path is part of the measurement.
+    Result Measure(uint32_t threads) {
+        Concurrency::WorkStealingQueue<uint64_t, 256> queue;
+        std::atomic<uint64_t> taken{ 0 };
+        std::atomic<bool> done{ false };
+        const uint64_t total = static_cast<uint64_t>(Bursts) * BurstSize;
+
+        double seconds = Bench::RunThreads(threads, [&](uint32_t t) {
+            uint64_t local = 0;
+            if (t == 0) {
+                for (uint32_t burst = 0; burst < Bursts; ++burst) {
+                    for (uint32_t i = 0; i < BurstSize; ++i)
+                        queue.Push(static_cast<uint64_t>(burst) * BurstSize + i);
+                    while (queue.Pop())
+                        ++local;
+                }
+                taken.fetch_add(local);
+                done.store(true, std::memory_order_release);
+            } else {
+                while (!done.load(std::memory_order_acquire)) {
+                    if (queue.Steal())
+                        ++local;
+                }
+                taken.fetch_add(local);
+            }
+        });
+
+        // Every push is matched by exactly one successful pop or steal
+        return { 2.0 * static_cast<double>(total) / seconds, taken.load() != total };
+    }
+}
+
+LM_BENCHMARK(WorkStealingQueueStress)
+{
+    for (uint32_t threads : Bench::GetThreadCounts()) {
+        Result result = Measure(threads);
+        Bench::Report("WorkStealingQueueStress", "owner_vs_" + std::to_string(threads - 1) + "_stealers",
+                      threads, "ops_per_sec", result.opsPerSec);
+        if (result.lostItems)
+            std::fprintf(stderr, "WorkStealingQueueStress: item count mismatch at %u threads\n", threads);
+    }
+}
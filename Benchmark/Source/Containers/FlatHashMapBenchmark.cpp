@@ -0,0 +1,90 @@
+#include "Benchmark.h"
+#include "Core/Containers/FlatHashMap.h"
+
+#include <chrono>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr size_t Sizes[] = { 1'000, 100'000, 1'000'000 };
+    constexpr size_t Lookups = 2'000'000;
+
+    using Clock = std::chrono::steady_clock;
+
+    double NanosecondsPer(Clock::time_point start, size_t operations) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(operations);
+    }
+
+    // Uniform access over the map: hits use present keys, misses use keys that were never inserted
+    template<typename Map, typename InsertFn, typename FindFn, typename EraseFn>
+    void Measure(const char* variant, size_t count, Map& map, InsertFn insert, FindFn find, EraseFn erase) {
+        std::mt19937_64 random(count);
+        std::vector<uint64_t> keys(count);
+        for (uint64_t& key : keys)
+            key = random() | 1;   // Odd keys present, even keys absent
+
+        const std::string name = std::string(variant) + "_" + std::to_string(count);
+
+        auto start = Clock::now();
+        for (uint64_t key : keys)
+            insert(map, key);
+        Bench::Report("FlatHashMap", name, 1, "ns_per_insert", NanosecondsPer(start, count));
+
+        uint64_t checksum = 0;
+        start = Clock::now();
+        for (size_t i = 0; i < Lookups; ++i)
+            checksum += find(map, keys[(i * 7919) % count]);
+        Bench::Report("FlatHashMap", name, 1, "ns_per_hit", NanosecondsPer(start, Lookups));
+
+        start = Clock::now();
+        for (size_t i = 0; i < Lookups; ++i)
+            checksum += find(map, keys[(i * 7919) % count] & ~uint64_t(1));
+        Bench::Report("FlatHashMap", name, 1, "ns_per_miss", NanosecondsPer(start, Lookups));
+
+        start = Clock::now();
+        for (const auto& entry : map)
+            checksum += entry.second;
+        Bench::Report("FlatHashMap", name, 1, "ns_per_element_iterated", NanosecondsPer(start, count));
+
+        start = Clock::now();
+        for (uint64_t key : keys)
+            erase(map, key);
+        Bench::Report("FlatHashMap", name, 1, "ns_per_erase", NanosecondsPer(start, count));
+
+        if (checksum == 42)
+            std::fprintf(stderr, "unlikely checksum\n");
+    }
+}
+
+LM_BENCHMARK(FlatHashMap)
+{
+    auto stdInsert = [](auto& map, uint64_t key) { map.emplace(key, key); };
+    auto stdFind = [](auto& map, uint64_t key) -> uint64_t { auto it = map.find(key); return it != map.end() ? it->second : 0; };
+    auto stdErase = [](auto& map, uint64_t key) { map.erase(key); };
+
+    auto flatInsert = [](auto& map, uint64_t key) { map.TryEmplace(key, key); };
+    auto flatFind = [](auto& map, uint64_t key) -> uint64_t { const uint64_t* value = map.TryGet(key); return value ? *value : 0; };
+    auto flatErase = [](auto& map, uint64_t key) { map.Erase(key); };
+
+    for (size_t count : Sizes) {
+        {
+            std::unordered_map<uint64_t, uint64_t> map;
+            Measure("std_unordered_map", count, map, stdInsert, stdFind, stdErase);
+        }
+        {
+            std::pmr::unsynchronized_pool_resource pool;
+            std::pmr::unordered_map<uint64_t, uint64_t> map(&pool);
+            Measure("pmr_unordered_map_pool", count, map, stdInsert, stdFind, stdErase);
+        }
+        {
+            Containers::FlatHashMap<uint64_t, uint64_t> map;
+            Measure("flat_hash_map", count, map, flatInsert, flatFind, flatErase);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#include "Benchmark.h"
+#include "Core/Containers/FixedVector.h"
+#include "Core/Containers/SmallVector.h"
+
+#include <chrono>
+#include <memory_resource>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr size_t Lists = 100'000;
+    constexpr size_t Frames = 20;
+
+    using Clock = std::chrono::steady_clock;
+
+    // Per-frame pattern: build many short lists (0-11 entries, mostly under 8), read them, throw them away
+    template<typename List, typename MakeFn>
+    void Measure(const char* variant, MakeFn make) {
+        uint64_t checksum = 0;
+        auto start = Clock::now();
+        for (size_t frame = 0; frame < Frames; ++frame) {
+            std::vector<List> lists;
+            lists.reserve(Lists);
+            for (size_t i = 0; i < Lists; ++i) {
+                List& list = lists.emplace_back(make());
+                const size_t count = (i * 2654435761u) % 12;
+                for (uint32_t j = 0; j < count; ++j)
+                    list.push_back(j);
+            }
+            for (const List& list : lists)
+                for (uint32_t value : list)
+                    checksum += value;
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(Frames * Lists);
+        Bench::Report("SmallVector", variant, 1, "ns_per_list", ns);
+        if (checksum == 42)
+            std::fprintf(stderr, "unlikely checksum\n");
+    }
+
+    // std-style push_back so one harness drives every container
+    template<typename Base>
+    struct Adapter : Base {
+        using Base::Base;
+        void push_back(uint32_t value) { this->PushBack(value); }
+    };
+}
+
+LM_BENCHMARK(SmallVector)
+{
+    Measure<std::vector<uint32_t>>("std_vector", []() { return std::vector<uint32_t>(); });
+    Measure<Adapter<Containers::SmallVector<uint32_t, 8>>>("small_vector_8", []() { return Adapter<Containers::SmallVector<uint32_t, 8>>(); });
+    Measure<Adapter<Containers::FixedVector<uint32_t, 12>>>("fixed_vector_12", []() { return Adapter<Containers::FixedVector<uint32_t, 12>>(); });
+}
@@ -0,0 +1,192 @@
+#include "Benchmark.h"
+#include "Core/Log.h"
+#include "Core/Logging/DeferredLog.h"
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr uint32_t ThreadCounts[] = { 1, 2, 4, 8, 16 };
+    constexpr size_t MessageSizes[] = { 16, 128, 1024 };
+    constexpr LogOverflowPolicy Policies[] = { LogOverflowPolicy::Block, LogOverflowPolicy::DropNewest, LogOverflowPolicy::OverrunOldest };
+    constexpr uint32_t MessagesPerRun = 32768;  // Split evenly across the producers
+    constexpr size_t QueueSize = 8192;          // LogConfig defaults
+    constexpr const char* FilePattern = "[%Y-%m-%d %T.%e] [%l] [%n] %v";
+
+    enum class SinkType { Null, File, Console };
+
+    // Async: LM_CORE_LOG_INFO through spdlog's queue. Deferred: LM_LOG_FAST_INFO through DeferredLog.
+    enum class Backend { Async, Deferred };
+
+    // Log::Init turns duplicate suppression on by default, which adds a hash and call-site bookkeeping to
+    // every LM_CORE_LOG_* call; async runs are measured both ways. LM_LOG_FAST_* does not suppress.
+    enum class Suppression { Off, On };
+
+    using Clock = std::chrono::steady_clock;
+
+    const char* ToString(SinkType sink) {
+        switch (sink) {
+            case SinkType::Null:    return "null";
+            case SinkType::File:    return "file";
+            case SinkType::Console: return "console";
+        }
+        return "unknown";
+    }
+
+    const char* ToString(LogOverflowPolicy policy) {
+        switch (policy) {
+            case LogOverflowPolicy::Block:         return "block";
+            case LogOverflowPolicy::DropNewest:    return "drop_newest";
+            case LogOverflowPolicy::OverrunOldest: return "overrun_oldest";
+        }
+        return "unknown";
+    }
+
+    spdlog::async_overflow_policy ToSpdlog(LogOverflowPolicy policy) {
+        switch (policy) {
+            case LogOverflowPolicy::Block:         return spdlog::async_overflow_policy::block;
+            case LogOverflowPolicy::OverrunOldest: return spdlog::async_overflow_policy::overrun_oldest;
+            case LogOverflowPolicy::DropNewest:    break;
+        }
+        return spdlog::async_overflow_policy::discard_new;
+    }
+
+    spdlog::sink_ptr MakeSink(SinkType type) {
+        switch (type) {
+            case SinkType::File:
+                return std::make_shared<spdlog::sinks::basic_file_sink_mt>(
+                    (std::filesystem::temp_directory_path() / "lm_log_latency.log").string(), true);
+            case SinkType::Console:
+                // stderr, so the CSV on stdout stays parseable; redirect it to measure without a terminal
+                return std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
+            case SinkType::Null:
+                break;
+        }
+        return std::make_shared<spdlog::sinks::null_sink_mt>();
+    }
+
+    // One configuration: producers log MessagesPerRun messages between them, timing every call. The logger
+    // is installed as spdlog's default, which is what the core macros use when Log::Init has not run.
+    void Run(const char* benchmark, Backend backend, SinkType sinkType, LogOverflowPolicy policy,
+             size_t messageSize, uint32_t threads, Suppression suppression, bool filtered = false) {
+        auto sink = MakeSink(sinkType);
+        sink->set_pattern(FilePattern);
+        auto pool = std::make_shared<spdlog::details::thread_pool>(QueueSize, 1);
+        auto logger = std::make_shared<spdlog::async_logger>("LogLatency", sink, pool, ToSpdlog(policy));
+        logger->set_level(filtered ? spdlog::level::warn : spdlog::level::trace);
+
+        auto previous = spdlog::default_logger();
+        spdlog::set_default_logger(logger);
+        Log::SetSuppressDuplicates(suppression == Suppression::On);
+        if (backend == Backend::Deferred) {
+            Logging::DeferredLog::Config config;
+            config.Overflow = policy;
+            Logging::DeferredLog::Start(config);
+        }
+        const uint64_t deferredDropsBefore = Logging::DeferredLog::GetStats().Dropped;
+
+        const std::string payload(messageSize, 'x');
+        const uint32_t perThread = MessagesPerRun / threads;
+        std::vector<std::vector<uint32_t>> latencies(threads, std::vector<uint32_t>(perThread));
+
+        const double producerSeconds = Bench::RunThreads(threads, [&](uint32_t t) {
+            auto& samples = latencies[t];
+            for (uint32_t i = 0; i < perThread; ++i) {
+                const auto before = Clock::now();
+                if (backend == Backend::Async)
+                    LM_CORE_LOG_INFO("frame {} thread {} {}", i, t, payload);
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 2
+                else
+                    LM_LOG_FAST_INFO(Core, "frame {} thread {} {}", i, t, payload);
+#endif
+                samples[i] = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - before).count());
+            }
+        });
+
+        // Delivery: everything still queued is written before the pool's worker exits
+        const auto drainStart = Clock::now();
+        if (backend == Backend::Deferred)
+            Logging::DeferredLog::Stop();
+        uint64_t dropped = Logging::DeferredLog::GetStats().Dropped - deferredDropsBefore;
+        dropped += pool->overrun_counter() + pool->discard_counter();
+        spdlog::set_default_logger(previous);
+        logger.reset();
+        pool.reset();
+        const double totalSeconds = producerSeconds + std::chrono::duration<double>(Clock::now() - drainStart).count();
+        Log::SetSuppressDuplicates(false);
+
+        std::vector<uint32_t> all;
+        all.reserve(static_cast<size_t>(perThread) * threads);
+        for (const auto& samples : latencies)
+            all.insert(all.end(), samples.begin(), samples.end());
+        std::sort(all.begin(), all.end());
+        auto percentile = [&all](double q) { return static_cast<double>(all[static_cast<size_t>(q * (all.size() - 1))]); };
+
+        const double messages = static_cast<double>(all.size());
+        std::string variant = filtered ? std::string("filtered")
+                                       : std::string(backend == Backend::Async ? "async" : "deferred") + "_" +
+                                         ToString(sinkType) + "_" + ToString(policy);
+        variant += "_" + std::to_string(messageSize) + "B";
+        if (suppression == Suppression::On)
+            variant += "_dedup";
+
+        Bench::Report(benchmark, variant, threads, "p50_ns", percentile(0.5));
+        Bench::Report(benchmark, variant, threads, "p99_ns", percentile(0.99));
+        Bench::Report(benchmark, variant, threads, "p999_ns", percentile(0.999));
+        Bench::Report(benchmark, variant, threads, "max_ns", all.back());
+        Bench::Report(benchmark, variant, threads, "calls_per_sec", messages / producerSeconds);
+        if (filtered)
+            return;     // Nothing was meant to be delivered
+        Bench::Report(benchmark, variant, threads, "delivered_per_sec", (messages - static_cast<double>(dropped)) / totalSeconds);
+        Bench::Report(benchmark, variant, threads, "dropped", static_cast<double>(dropped));
+    }
+
+    void Sweep(const char* benchmark, SinkType sink) {
+        for (uint32_t threads : ThreadCounts) {
+            for (LogOverflowPolicy policy : Policies) {
+                for (size_t size : MessageSizes) {
+                    Run(benchmark, Backend::Async, sink, policy, size, threads, Suppression::Off);
+                    Run(benchmark, Backend::Async, sink, policy, size, threads, Suppression::On);
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 2
+                    // DeferredLog cannot overrun its rings, so OverrunOldest would repeat DropNewest
+                    if (policy != LogOverflowPolicy::OverrunOldest)
+                        Run(benchmark, Backend::Deferred, sink, policy, size, threads, Suppression::Off);
+#endif
+                }
+            }
+        }
+    }
+}
+
+// Cost of a logging call as seen by the caller, and what reaches the sink. Run one sink at a time with
+// e.g. "Benchmark LogLatencyFile"; only Release/Dist numbers are meaningful.
+LM_BENCHMARK(LogLatencyNull)
+{
+    // Baseline: a call filtered out by the logger level
+    for (uint32_t threads : ThreadCounts)
+        Run("LogLatencyNull", Backend::Async, SinkType::Null, LogOverflowPolicy::DropNewest, MessageSizes[0], threads, Suppression::Off, true);
+    Sweep("LogLatencyNull", SinkType::Null);
+}
+
+LM_BENCHMARK(LogLatencyFile)
+{
+    Sweep("LogLatencyFile", SinkType::File);
+    std::error_code error;
+    std::filesystem::remove(std::filesystem::temp_directory_path() / "lm_log_latency.log", error);
+}
+
+LM_BENCHMARK(LogLatencyConsole)
+{
+    Sweep("LogLatencyConsole", SinkType::Console);
+}
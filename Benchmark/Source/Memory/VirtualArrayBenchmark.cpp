@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+#include "Core/Memory/VirtualArray.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+
+    constexpr size_t ElementCounts[] = { 10'000, 1'000'000, 16'000'000 };
+    constexpr size_t MaxElements = 64'000'000;
+    constexpr int IterationPasses = 10;
+
+    // A typical hot-table row: big enough that copies on regrowth are not free
+    struct Row {
+        float position[3];
+        float velocity[3];
+        uint32_t flags;
+        uint32_t id;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    double NanosecondsPer(Clock::time_point start, size_t operations) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(operations);
+    }
+
+    // Push count rows one at a time, then sweep them repeatedly; reports ns per element for each phase
+    template<typename Container, typename PushFn>
+    void Measure(const char* variant, size_t count, Container& rows, PushFn push) {
+        auto start = Clock::now();
+        for (size_t i = 0; i < count; ++i)
+            push(rows, Row{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f }, 0, static_cast<uint32_t>(i) });
+        double growth = NanosecondsPer(start, count);
+
+        start = Clock::now();
+        volatile float sink = 0.0f;
+        for (int pass = 0; pass < IterationPasses; ++pass) {
+            float sum = 0.0f;
+            for (Row& row : rows) {
+                row.position[0] += row.velocity[0];
+                sum += row.position[0];
+            }
+            sink = sink + sum;
+        }
+        double iteration = NanosecondsPer(start, count * IterationPasses);
+
+        std::string name = std::string(variant) + "_" + std::to_string(count);
+        Bench::Report("VirtualArrayGrowth", name, 1, "ns_per_push", growth);
+        Bench::Report("VirtualArrayGrowth", name, 1, "ns_per_element_iterated", iteration);
+    }
+}
+
+LM_BENCHMARK(VirtualArrayGrowth)
+{
+    for (size_t count : ElementCounts) {
+        {
+            std::vector<Row> rows;
+            Measure("std_vector", count, rows, [](auto& r, const Row& row) { r.push_back(row); });
+        }
+        {
+            std::vector<Row> rows;
+            rows.reserve(count);
+            Measure("std_vector_reserved", count, rows, [](auto& r, const Row& row) { r.push_back(row); });
+        }
+        {
+            Memory::VirtualArray<Row> rows(MaxElements);
+            Measure("virtual_array", count, rows, [](auto& r, const Row& row) { r.PushBack(row); });
+        }
+        {
+            Memory::VirtualArray<Row> rows(MaxElements, true);
+            Measure("virtual_array_huge_pages", count, rows, [](auto& r, const Row& row) { r.PushBack(row); });
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#include "Benchmark.h"
+
+#include <cstring>
+
+// Usage: Benchmark [filter...]
+// Runs every registered benchmark whose name contains one of the filters (all when none given).
+int main(int argc, char** argv)
+{
+    std::printf("benchmark,variant,threads,metric,value\n");
+
+    for (const auto& benchmark : Limitless::Bench::GetRegistry()) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc && !selected; ++i)
+            selected = std::strstr(benchmark.name, argv[i]) != nullptr;
+        if (selected)
+            benchmark.function();
+    }
+    return 0;
+}
@@ -2,6 +2,11 @@
 #include "Application.h"
 #include "Core/SDLManager.h"
 #include "Core/Log.h"
+#include "Core/Concurrency/Epoch.h"
+#include "Core/Concurrency/JobSystem.h"
+#include "Core/Concurrency/MainThreadDispatcher.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
 #include "Renderer/RenderCommand.h"
 #include "Renderer/SDLRenderAPI.h"
 
@@ -13,7 +18,10 @@ namespace Limitless {
         : m_Name(name)
     {
         s_Instance = this;
-        Log::Init(m_Name);
+        {
+            LM_MEMTAG(Logging);
+            Log::Init(m_Name);
+        }
         LM_CORE_LOG_INFO("Creating Application (Name: {}) ", m_Name);
     }
 
@@ -32,30 +40,63 @@ namespace Limitless {
             throw std::runtime_error("Failed to initialize SDL in Application::Run");
         }
 
-        // Create primary window before client Initialize so they can query it
-        m_Window = std::make_unique<Window>(GetDefaultWindowDesc());
+        // Worker threads are available to the client from Initialize onwards
+        Concurrency::MainThreadDispatcher::Get().SetMainThread();
+        {
+            LM_MEMTAG(Jobs);
+            Concurrency::JobSystem::Get().Initialize();
+        }
 
-        // Initialize default renderer (SDL 2D for now)
-        m_RenderAPI = std::make_unique<SDLRenderAPI>();
-        m_RenderAPI->Initialize(*m_Window);
-        RenderCommand::Init(m_RenderAPI.get());
+        {
+            LM_MEMTAG(Renderer);
+
+            // Create primary window before client Initialize so they can query it
+            m_Window = std::make_unique<Window>(GetDefaultWindowDesc());
+
+            // Initialize default renderer (SDL 2D for now)
+            m_RenderAPI = std::make_unique<SDLRenderAPI>();
+            m_RenderAPI->Initialize(*m_Window);
+            RenderCommand::Init(m_RenderAPI.get());
+        }
 
         Initialize();
 
         while (m_Running)
         {
+            // Recycle the per-frame scratch memory of the oldest frame still buffered
+            Memory::FrameAllocator::Get().BeginFrame();
+            Memory::MemoryTracker::BeginFrame();
+
             // Drive events; if window requests quit, stop running
             if (!m_Window->PollEvents()) {
                 m_Running = false;
                 break;
             }
 
+            // Resume work that asked to wait for this frame (e.g. coroutines awaiting NextFrame()),
+            // then run work other threads posted for the main thread (SDL calls, renderer access)
+            Concurrency::MainThreadDispatcher::Get().BeginFrame();
+            Concurrency::MainThreadDispatcher::Get().DrainFrame();
+
+            // Independent per-frame work in parallel; the main thread helps until the graph completes
+            m_FrameGraph.Execute();
+
+            // Frame boundary: free memory lock-free structures retired once no thread can still see it
+            Concurrency::EpochManager::Get().Collect();
+
             // Simple clear/present cycle for now
             RenderCommand::Clear();
             RenderCommand::Present();
         }
 
         Shutdown();
+        m_FrameGraph.Clear();
+
+        // Finish any in-flight jobs before tearing down the resources they may touch,
+        // then run whatever they posted back to the main thread
+        Concurrency::JobSystem::Get().Shutdown();
+        Concurrency::MainThreadDispatcher::Get().DrainAll();
+        Memory::FrameAllocator::Get().ReleaseMemory();
 
         // Explicitly reset renderer and window before SDL shutdown
         if (m_RenderAPI) {
@@ -2,6 +2,7 @@
 
 #include "lmpch.h"
 #include "Core/Window.h"
+#include "Core/Concurrency/TaskGraph.h"
 #include "Renderer/RenderAPI.h"
 #include "Renderer/SDLRenderAPI.h"
 #include <memory>
@@ -31,11 +32,15 @@ namespace Limitless {
         Window& GetWindow() { return *m_Window; }
         const Window& GetWindow() const { return *m_Window; }
 
+        // Per-frame jobs; register nodes in Initialize and they run every frame on the worker threads
+        Concurrency::TaskGraph& GetFrameGraph() { return m_FrameGraph; }
+
     private:
         std::string m_Name;
         bool m_Running = true;
         std::unique_ptr<Window> m_Window;
         std::unique_ptr<RenderAPI> m_RenderAPI;
+        Concurrency::TaskGraph m_FrameGraph;
 
     private:
         static Application* s_Instance;
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Lock-free single-producer single-consumer ring of variable-length records.
+        // The producer reserves contiguous bytes, writes them in place and commits; the consumer reads the
+        // record in place and consumes it. Nothing is copied and nothing is allocated after construction.
+        // A record that would straddle the end of the buffer is preceded by a padding record that fills the
+        // tail, so every payload is contiguous.
+        //
+        //     auto bytes = ring.Reserve(n);      // producer
+        //     if (!bytes.empty()) { Fill(bytes); ring.Commit(); }
+        //
+        //     auto record = ring.TryRead();      // consumer
+        //     if (!record.empty()) { Use(record); ring.Consume(); }
+        class SPSCByteRing
+        {
+        public:
+            static constexpr size_t Alignment = 8;
+
+            // capacityBytes is rounded up to a power of two
+            explicit SPSCByteRing(size_t capacityBytes)
+                : m_Capacity(RoundUpPow2(capacityBytes < 64 ? 64 : capacityBytes))
+                , m_Buffer(static_cast<std::byte*>(::operator new(m_Capacity, std::align_val_t(64))))
+            {
+            }
+
+            ~SPSCByteRing()
+            {
+                ::operator delete(m_Buffer, std::align_val_t(64));
+            }
+
+            SPSCByteRing(const SPSCByteRing&) = delete;
+            SPSCByteRing& operator=(const SPSCByteRing&) = delete;
+
+            size_t GetCapacity() const noexcept { return m_Capacity; }
+
+            // Largest payload that can always be reserved once the consumer has caught up
+            size_t GetMaxRecordSize() const noexcept { return m_Capacity / 2 - HeaderSize; }
+
+            // Producer --------------------------------------------------------------------------
+
+            // Reserve size contiguous bytes. Returns an empty span when the ring is too full (or size exceeds
+            // GetMaxRecordSize()). Reserving again without committing discards the previous reservation.
+            std::span<std::byte> Reserve(size_t size) noexcept
+            {
+                if (size == 0 || size > GetMaxRecordSize())
+                    return {};
+
+                const size_t total = AlignUp(HeaderSize + size);
+                uint64_t write = m_ProducerWrite;
+                size_t offset = static_cast<size_t>(write) & (m_Capacity - 1);
+                const size_t tillEnd = m_Capacity - offset;
+                const size_t needed = total > tillEnd ? tillEnd + total : total;
+
+                if (needed > m_Capacity - static_cast<size_t>(write - m_CachedRead))
+                {
+                    m_CachedRead = m_Read.load(std::memory_order_acquire);
+                    if (needed > m_Capacity - static_cast<size_t>(write - m_CachedRead))
+                        return {};
+                }
+
+                if (total > tillEnd)
+                {
+                    // Fill the tail with padding; it becomes visible together with the record at Commit
+                    WriteHeader(offset, static_cast<uint32_t>(tillEnd - HeaderSize), PaddingFlag);
+                    write += tillEnd;
+                    offset = 0;
+                }
+
+                m_ReservedAt = write;
+                m_ReservedSize = size;
+                return { m_Buffer + offset + HeaderSize, size };
+            }
+
+            // Publish the reserved record. used may shrink the record to the bytes actually written.
+            void Commit(size_t used) noexcept
+            {
+                if (used > m_ReservedSize)
+                    used = m_ReservedSize;
+                WriteHeader(static_cast<size_t>(m_ReservedAt) & (m_Capacity - 1), static_cast<uint32_t>(used), 0);
+                m_ProducerWrite = m_ReservedAt + AlignUp(HeaderSize + used);
+                m_ReservedSize = 0;
+                m_Write.store(m_ProducerWrite, std::memory_order_release);
+            }
+
+            void Commit() noexcept { Commit(m_ReservedSize); }
+
+            // Copying convenience for small records
+            bool TryWrite(const void* data, size_t size) noexcept
+            {
+                std::span<std::byte> bytes = Reserve(size);
+                if (bytes.empty())
+                    return false;
+                std::memcpy(bytes.data(), data, size);
+                Commit();
+                return true;
+            }
+
+            // Consumer --------------------------------------------------------------------------
+
+            // Next committed record, or an empty span. The span stays valid until Consume().
+            std::span<const std::byte> TryRead() noexcept
+            {
+                for (;;)
+                {
+                    if (m_ConsumerRead == m_CachedWrite)
+                    {
+                        m_CachedWrite = m_Write.load(std::memory_order_acquire);
+                        if (m_ConsumerRead == m_CachedWrite)
+                            return {};
+                    }
+
+                    const size_t offset = static_cast<size_t>(m_ConsumerRead) & (m_Capacity - 1);
+                    RecordHeader header;
+                    std::memcpy(&header, m_Buffer + offset, HeaderSize);
+                    if (header.Flags & PaddingFlag)
+                    {
+                        m_ConsumerRead += HeaderSize + header.Size;
+                        continue;
+                    }
+
+                    m_PeekedSize = AlignUp(HeaderSize + header.Size);
+                    return { m_Buffer + offset + HeaderSize, header.Size };
+                }
+            }
+
+            // Release the record returned by the last TryRead back to the producer
+            void Consume() noexcept
+            {
+                m_ConsumerRead += m_PeekedSize;
+                m_PeekedSize = 0;
+                m_Read.store(m_ConsumerRead, std::memory_order_release);
+            }
+
+            // Approximate number of bytes in flight (headers and padding included)
+            size_t GetUsedBytes() const noexcept
+            {
+                uint64_t read = m_Read.load(std::memory_order_acquire);
+                uint64_t write = m_Write.load(std::memory_order_acquire);
+                return static_cast<size_t>(write - read);
+            }
+
+            bool IsEmpty() const noexcept { return GetUsedBytes() == 0; }
+
+        private:
+            struct RecordHeader
+            {
+                uint32_t Size;  // Payload bytes (excluding header and alignment)
+                uint32_t Flags;
+            };
+
+            static constexpr size_t HeaderSize = sizeof(RecordHeader);
+            static constexpr uint32_t PaddingFlag = 1u;
+            static_assert(HeaderSize % Alignment == 0);
+
+            static constexpr size_t AlignUp(size_t value) noexcept { return (value + Alignment - 1) & ~(Alignment - 1); }
+
+            static size_t RoundUpPow2(size_t value) noexcept
+            {
+                size_t result = 1;
+                while (result < value)
+                    result <<= 1;
+                return result;
+            }
+
+            void WriteHeader(size_t offset, uint32_t size, uint32_t flags) noexcept
+            {
+                RecordHeader header{ size, flags };
+                std::memcpy(m_Buffer + offset, &header, HeaderSize);
+            }
+
+        private:
+            const size_t m_Capacity;
+            std::byte* const m_Buffer;
+
+            // Producer-owned line
+            alignas(64) std::atomic<uint64_t> m_Write{ 0 };
+            uint64_t m_ProducerWrite = 0;
+            uint64_t m_CachedRead = 0;
+            uint64_t m_ReservedAt = 0;
+            size_t m_ReservedSize = 0;
+
+            // Consumer-owned line
+            alignas(64) std::atomic<uint64_t> m_Read{ 0 };
+            uint64_t m_ConsumerRead = 0;
+            uint64_t m_CachedWrite = 0;
+            size_t m_PeekedSize = 0;
+        };
+    }
+}
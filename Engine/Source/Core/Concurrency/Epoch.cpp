@@ -0,0 +1,163 @@
+#include "lmpch.h"
+#include "Core/Concurrency/Epoch.h"
+#include "Core/Log.h"
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        struct EpochManager::LocalState
+        {
+            uint32_t Depth = 0;
+            uint32_t Index = ThreadIndex::InvalidIndex;
+            bool Registered = false;
+            std::vector<Retired> Pending;
+
+            ~LocalState()
+            {
+                LM_ASSERT_MSG(Depth == 0, "Thread exited while pinned to an epoch");
+                // Whatever this thread retired outlives it; let the shared list free it later
+                if (!Pending.empty())
+                    EpochManager::Get().Flush(Pending);
+            }
+        };
+
+        EpochManager::LocalState& EpochManager::GetLocal() noexcept
+        {
+            thread_local LocalState local;
+            return local;
+        }
+
+        EpochManager& EpochManager::Get()
+        {
+            // Intentionally leaked: thread-exit flushes may run after static destruction has begun
+            static EpochManager* instance = new EpochManager();
+            return *instance;
+        }
+
+        void EpochManager::Pin() noexcept
+        {
+            LocalState& local = GetLocal();
+            if (local.Depth++ > 0)
+                return;
+
+            if (!local.Registered)
+            {
+                local.Registered = true;
+                local.Index = ThreadIndex::Get();
+                if (local.Index != ThreadIndex::InvalidIndex)
+                {
+                    uint32_t count = m_SlotCount.load(std::memory_order_relaxed);
+                    while (count <= local.Index &&
+                           !m_SlotCount.compare_exchange_weak(count, local.Index + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                    }
+                }
+            }
+
+            if (local.Index == ThreadIndex::InvalidIndex)
+            {
+                m_OverflowPins.fetch_add(1, std::memory_order_seq_cst);
+                return;
+            }
+
+            m_Slots[local.Index].PinnedEpoch.store(m_Epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            // The pin must be visible before any of this thread's reads of the shared structure
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void EpochManager::Unpin() noexcept
+        {
+            LocalState& local = GetLocal();
+            LM_ASSERT_MSG(local.Depth > 0, "EpochManager::Unpin without a matching Pin");
+            if (--local.Depth > 0)
+                return;
+
+            if (local.Index == ThreadIndex::InvalidIndex)
+                m_OverflowPins.fetch_sub(1, std::memory_order_release);
+            else
+                m_Slots[local.Index].PinnedEpoch.store(0, std::memory_order_release);
+        }
+
+        bool EpochManager::IsPinned() const noexcept
+        {
+            return GetLocal().Depth > 0;
+        }
+
+        void EpochManager::Retire(void* object, Deleter deleter)
+        {
+            if (!object)
+                return;
+
+            LocalState& local = GetLocal();
+            local.Pending.push_back({ m_Epoch.load(std::memory_order_seq_cst), object, deleter });
+            if (local.Pending.size() >= BatchSize)
+                Collect();
+        }
+
+        size_t EpochManager::Collect()
+        {
+            LocalState& local = GetLocal();
+            if (!local.Pending.empty())
+                Flush(local.Pending);
+
+            TryAdvance();
+            return FreeExpired();
+        }
+
+        size_t EpochManager::GetPendingCount() const
+        {
+            std::scoped_lock lock(m_LimboMutex);
+            return m_Limbo.size();
+        }
+
+        void EpochManager::Flush(std::vector<Retired>& pending)
+        {
+            std::scoped_lock lock(m_LimboMutex);
+            m_Limbo.insert(m_Limbo.end(), pending.begin(), pending.end());
+            pending.clear();
+        }
+
+        bool EpochManager::TryAdvance() noexcept
+        {
+            uint64_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (m_OverflowPins.load(std::memory_order_relaxed) != 0)
+                return false;
+
+            // Every pinned thread must have observed the current epoch
+            const uint32_t count = m_SlotCount.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                // Acquire pairs with Unpin so the reader's accesses happen before anything we free
+                uint64_t pinned = m_Slots[i].PinnedEpoch.load(std::memory_order_acquire);
+                if (pinned != 0 && pinned != epoch)
+                    return false;
+            }
+
+            return m_Epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        size_t EpochManager::FreeExpired()
+        {
+            const uint64_t epoch = m_Epoch.load(std::memory_order_acquire);
+
+            std::vector<Retired> expired;
+            {
+                std::scoped_lock lock(m_LimboMutex);
+                auto alive = std::partition(m_Limbo.begin(), m_Limbo.end(), [epoch](const Retired& retired)
+                {
+                    return retired.Epoch + 2 > epoch;
+                });
+                expired.assign(alive, m_Limbo.end());
+                m_Limbo.erase(alive, m_Limbo.end());
+            }
+
+            // Deleters run outside the lock; they may retire more memory
+            for (const Retired& retired : expired)
+                retired.Free(retired.Object);
+            return expired.size();
+        }
+    }
+}
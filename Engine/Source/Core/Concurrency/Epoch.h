@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Core/Concurrency/ThreadIndex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Epoch-based reclamation for lock-free structures.
+        // Readers pin the current epoch while they hold raw pointers into a shared structure; writers that
+        // unlink memory retire it instead of deleting it. Retired memory is freed once the global epoch has
+        // advanced twice past the epoch it was retired in, which can only happen after every thread pinned
+        // at that time has unpinned. Threads register implicitly through ThreadIndex on their first pin.
+        //
+        //     {
+        //         EpochManager::Guard guard;             // reader
+        //         Node* node = head.load(std::memory_order_acquire);
+        //         Use(node->Value);
+        //     }
+        //     EpochManager::Get().Retire(unlinked);      // writer, after unlinking
+        //
+        // Application::Run calls Collect once per frame; Retire also collects whenever a thread has
+        // accumulated a batch of garbage.
+        class EpochManager
+        {
+        public:
+            using Deleter = void (*)(void*);
+
+            // Keeps the calling thread pinned for its lifetime. Guards nest.
+            class Guard
+            {
+            public:
+                Guard() noexcept { EpochManager::Get().Pin(); }
+                ~Guard() { EpochManager::Get().Unpin(); }
+
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+            };
+
+            static EpochManager& Get();
+
+            void Pin() noexcept;
+            void Unpin() noexcept;
+            bool IsPinned() const noexcept;
+
+            // Free object with deleter once no thread can still be reading it
+            void Retire(void* object, Deleter deleter);
+
+            template<typename T>
+            void Retire(T* object)
+            {
+                Retire(static_cast<void*>(object), [](void* pointer) { delete static_cast<T*>(pointer); });
+            }
+
+            // Hand the calling thread's retired objects to the shared list, try to advance the epoch and free
+            // everything that has expired. Returns the number of objects freed.
+            size_t Collect();
+
+            uint64_t GetEpoch() const noexcept { return m_Epoch.load(std::memory_order_acquire); }
+
+            // Objects retired through Collect (or a full batch) but not freed yet
+            size_t GetPendingCount() const;
+
+        private:
+            struct Retired
+            {
+                uint64_t Epoch;
+                void* Object;
+                Deleter Free;
+            };
+
+            // Per-thread pin depth and retire batch
+            struct LocalState;
+            static LocalState& GetLocal() noexcept;
+
+            // One cache line per thread so pinning never contends
+            struct alignas(64) Slot
+            {
+                std::atomic<uint64_t> PinnedEpoch{ 0 }; // 0 when the thread is not pinned
+            };
+
+            static constexpr size_t BatchSize = 64;
+
+            EpochManager() = default;
+            EpochManager(const EpochManager&) = delete;
+            EpochManager& operator=(const EpochManager&) = delete;
+
+            void Flush(std::vector<Retired>& pending);
+            bool TryAdvance() noexcept;
+            size_t FreeExpired();
+
+        private:
+            alignas(64) std::atomic<uint64_t> m_Epoch{ 1 };
+            std::atomic<uint32_t> m_SlotCount{ 0 };      // Highest registered thread index + 1
+            std::atomic<uint32_t> m_OverflowPins{ 0 };   // Pins from threads without a ThreadIndex; block advancing
+            Slot m_Slots[ThreadIndex::MaxThreads];
+
+            mutable std::mutex m_LimboMutex;
+            std::vector<Retired> m_Limbo;
+        };
+    }
+}
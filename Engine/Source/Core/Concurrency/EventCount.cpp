@@ -0,0 +1,87 @@
+#include "lmpch.h"
+#include "Core/Concurrency/EventCount.h"
+
+#include <thread>
+
+#if defined(LM_PLATFORM_LINUX)
+    #include <climits>
+    #include <ctime>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+#if defined(LM_PLATFORM_LINUX)
+        // Talk to the futex directly so timed and untimed waits share one wake path
+        static void PlatformWait(std::atomic<uint32_t>& word, uint32_t expected, const timespec* timeout) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+        }
+
+        static void PlatformWake(std::atomic<uint32_t>& word, bool all) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+        }
+#endif
+
+        void EventCount::Wait(Key key) noexcept
+        {
+            while (m_Epoch.load(std::memory_order_acquire) == key)
+            {
+#if defined(LM_PLATFORM_LINUX)
+                PlatformWait(m_Epoch, key, nullptr);
+#else
+                m_Epoch.wait(key, std::memory_order_acquire);
+#endif
+            }
+            m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        bool EventCount::WaitFor(Key key, std::chrono::nanoseconds timeout) noexcept
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            bool notified = false;
+            for (;;)
+            {
+                if (m_Epoch.load(std::memory_order_acquire) != key)
+                {
+                    notified = true;
+                    break;
+                }
+                auto remaining = deadline - std::chrono::steady_clock::now();
+                if (remaining <= std::chrono::nanoseconds::zero())
+                    break;
+#if defined(LM_PLATFORM_LINUX)
+                auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+                timespec ts{};
+                ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+                ts.tv_nsec = static_cast<long>(ns % 1000000000);
+                PlatformWait(m_Epoch, key, &ts);
+#else
+                // std::atomic::wait has no timeout; back off with short sleeps instead
+                auto nap = std::chrono::duration_cast<std::chrono::microseconds>(remaining);
+                std::this_thread::sleep_for(nap < std::chrono::microseconds(500) ? nap : std::chrono::microseconds(500));
+#endif
+            }
+            m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+            return notified;
+        }
+
+        void EventCount::Wake(bool all) noexcept
+        {
+            m_Epoch.fetch_add(1, std::memory_order_release);
+#if defined(LM_PLATFORM_LINUX)
+            PlatformWake(m_Epoch, all);
+#else
+            if (all)
+                m_Epoch.notify_all();
+            else
+                m_Epoch.notify_one();
+#endif
+        }
+    }
+}
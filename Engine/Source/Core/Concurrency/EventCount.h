@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // CPU hint for spin-wait loops
+        inline void SpinPause() noexcept
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #if defined(_MSC_VER)
+            __yield();
+    #else
+            asm volatile("yield");
+    #endif
+#endif
+        }
+
+        // Eventcount: lets threads block on an arbitrary condition guarded by lock-free data.
+        // Producers pay a fence and a relaxed load when nobody is parked, so the wake syscall is skipped
+        // in the common case. Waiters register first, re-check their condition, then park:
+        //
+        //     auto key = events.PrepareWait();
+        //     if (condition()) events.CancelWait(); else events.Wait(key);
+        //
+        // Parks on a futex on Linux and on std::atomic::wait elsewhere.
+        class EventCount
+        {
+        public:
+            using Key = uint32_t;
+
+            EventCount() = default;
+            EventCount(const EventCount&) = delete;
+            EventCount& operator=(const EventCount&) = delete;
+
+            // Register as a waiter. The caller must re-check its condition before calling Wait.
+            Key PrepareWait() noexcept
+            {
+                m_Waiters.fetch_add(1, std::memory_order_relaxed);
+                // Pairs with the fence in Notify*: either the notifier sees this waiter, or the
+                // caller's re-check sees the notifier's data
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return m_Epoch.load(std::memory_order_acquire);
+            }
+
+            // Undo PrepareWait when the condition turned out to be satisfied
+            void CancelWait() noexcept
+            {
+                m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // Park until a notification newer than key arrives
+            void Wait(Key key) noexcept;
+
+            // As Wait, but gives up after timeout. Returns false on timeout.
+            bool WaitFor(Key key, std::chrono::nanoseconds timeout) noexcept;
+
+            void NotifyOne() noexcept
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_Waiters.load(std::memory_order_relaxed) != 0)
+                    Wake(false);
+            }
+
+            void NotifyAll() noexcept
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_Waiters.load(std::memory_order_relaxed) != 0)
+                    Wake(true);
+            }
+
+            // Block until condition() holds. Spins first; the spin length adapts to how often spinning
+            // has been enough recently, so short gaps never reach the kernel and long ones stop burning CPU.
+            template<typename Condition>
+            void Await(Condition&& condition)
+            {
+                if (Spin(condition))
+                    return;
+                for (;;)
+                {
+                    Key key = PrepareWait();
+                    if (condition())
+                    {
+                        CancelWait();
+                        return;
+                    }
+                    Wait(key);
+                    if (condition())
+                        return;
+                }
+            }
+
+            // As Await, but gives up after timeout. Returns whether the condition was observed.
+            template<typename Condition>
+            bool AwaitFor(Condition&& condition, std::chrono::nanoseconds timeout)
+            {
+                const auto deadline = std::chrono::steady_clock::now() + timeout;
+                if (Spin(condition))
+                    return true;
+                for (;;)
+                {
+                    Key key = PrepareWait();
+                    if (condition())
+                    {
+                        CancelWait();
+                        return true;
+                    }
+                    auto remaining = deadline - std::chrono::steady_clock::now();
+                    if (remaining <= std::chrono::nanoseconds::zero())
+                    {
+                        CancelWait();
+                        return false;
+                    }
+                    WaitFor(key, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+                    if (condition())
+                        return true;
+                }
+            }
+
+        private:
+            static constexpr uint32_t MinSpin = 16;
+            static constexpr uint32_t MaxSpin = 4096;
+
+            template<typename Condition>
+            bool Spin(Condition& condition)
+            {
+                const uint32_t limit = m_SpinLimit.load(std::memory_order_relaxed);
+                for (uint32_t i = 0; i < limit; ++i)
+                {
+                    if (condition())
+                    {
+                        // Spinning paid off: allow a little more next time
+                        uint32_t grown = limit + limit / 8 + 1;
+                        m_SpinLimit.store(grown < MaxSpin ? grown : MaxSpin, std::memory_order_relaxed);
+                        return true;
+                    }
+                    SpinPause();
+                }
+                // Had to park anyway: halve the budget
+                m_SpinLimit.store(limit / 2 > MinSpin ? limit / 2 : MinSpin, std::memory_order_relaxed);
+                return false;
+            }
+
+            void Wake(bool all) noexcept;
+
+        private:
+            alignas(64) std::atomic<uint32_t> m_Epoch{ 0 };
+            std::atomic<uint32_t> m_Waiters{ 0 };
+            std::atomic<uint32_t> m_SpinLimit{ 256 };
+        };
+    }
+}
@@ -0,0 +1,304 @@
+#include "lmpch.h"
+#include "Core/Concurrency/JobSystem.h"
+#include "Core/Log.h"
+
+#include <SDL3/SDL_cpuinfo.h>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        static thread_local int t_WorkerIndex = -1;
+        static thread_local uint32_t t_RandomState = 0;
+
+        // xorshift32; only used to pick steal victims so quality doesn't matter
+        static uint32_t NextRandom()
+        {
+            uint32_t x = t_RandomState;
+            if (x == 0)
+                x = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            t_RandomState = x;
+            return x;
+        }
+
+        void JobCounter::Decrement() noexcept
+        {
+            uint64_t previous = m_State.fetch_sub(1, std::memory_order_acq_rel);
+            LM_ASSERT_MSG((previous & CountMask) != 0, "JobCounter decremented below zero");
+
+            if ((previous & CountMask) == 1 && (previous & WaitersFlag))
+                ResumeWaiters(nullptr);
+        }
+
+        bool JobCounter::AddWaiter(JobCounterWaiter* waiter) noexcept
+        {
+            if (IsDone())
+                return false;
+
+            JobCounterWaiter* head = m_Waiters.load(std::memory_order_relaxed);
+            do
+            {
+                waiter->Next = head;
+            } while (!m_Waiters.compare_exchange_weak(head, waiter, std::memory_order_release, std::memory_order_relaxed));
+
+            // Both sides touch m_State with an RMW, so either the final Decrement sees the flag and drains
+            // the list, or we see the count already at zero and drain it ourselves
+            uint64_t previous = m_State.fetch_or(WaitersFlag, std::memory_order_acq_rel);
+            if ((previous & CountMask) != 0)
+                return true;
+            return !ResumeWaiters(waiter);
+        }
+
+        bool JobCounter::ResumeWaiters(JobCounterWaiter* skip) noexcept
+        {
+            m_State.fetch_and(~WaitersFlag, std::memory_order_acq_rel);
+            JobCounterWaiter* waiter = m_Waiters.exchange(nullptr, std::memory_order_acq_rel);
+
+            bool skipped = false;
+            while (waiter)
+            {
+                // The node lives in the coroutine frame; read it before the coroutine can run
+                JobCounterWaiter* next = waiter->Next;
+                if (waiter == skip)
+                {
+                    skipped = true;
+                }
+                else
+                {
+                    std::coroutine_handle<> handle = waiter->Handle;
+                    JobSystem::Get().Run([handle]() { handle.resume(); });
+                }
+                waiter = next;
+            }
+            return skipped;
+        }
+
+        void JobHandle::Wait() const
+        {
+            if (m_Counter)
+                JobSystem::Get().Wait(*m_Counter);
+        }
+
+        JobSystem& JobSystem::Get()
+        {
+            static JobSystem instance;
+            return instance;
+        }
+
+        JobSystem::~JobSystem()
+        {
+            Shutdown();
+        }
+
+        void JobSystem::Initialize(uint32_t workerCount)
+        {
+            if (m_Initialized)
+                return;
+
+            if (workerCount == 0)
+            {
+                // The thread that waits on a counter helps execute jobs, so leave one core for it
+                int cores = SDL_GetNumLogicalCPUCores();
+                workerCount = cores > 1 ? static_cast<uint32_t>(cores - 1) : 1u;
+            }
+
+            m_Running.store(true, std::memory_order_release);
+            m_Workers.reserve(workerCount);
+            for (uint32_t i = 0; i < workerCount; ++i)
+                m_Workers.push_back(std::make_unique<Worker>());
+
+            // Start threads only once every worker exists so stealers never see a partial vector
+            for (uint32_t i = 0; i < workerCount; ++i)
+                m_Workers[i]->Thread = std::thread([this, i]() { WorkerLoop(i); });
+
+            m_Initialized = true;
+            LM_LOG_CAT_INFO(Concurrency, "JobSystem initialized with {} worker threads", workerCount);
+        }
+
+        void JobSystem::Shutdown()
+        {
+            if (!m_Initialized)
+                return;
+
+            // Let everything already submitted finish before stopping the workers
+            while (m_PendingJobs.load(std::memory_order_acquire) != 0)
+            {
+                if (!TryExecuteOne())
+                    std::this_thread::yield();
+            }
+
+            m_Running.store(false, std::memory_order_release);
+            m_WakeEvent.NotifyAll();
+
+            for (auto& worker : m_Workers)
+            {
+                if (worker->Thread.joinable())
+                    worker->Thread.join();
+            }
+            m_Workers.clear();
+            m_Initialized = false;
+            LM_LOG_CAT_INFO(Concurrency, "JobSystem shut down");
+        }
+
+        int JobSystem::GetCurrentWorkerIndex() noexcept
+        {
+            return t_WorkerIndex;
+        }
+
+        void JobSystem::Run(JobFunction function, JobCounter* counter)
+        {
+            if (!m_Initialized)
+            {
+                function();
+                return;
+            }
+
+            if (counter)
+                counter->Increment();
+
+            Job* job = m_JobPool.Acquire(std::move(function), counter, nullptr);
+            Submit(job);
+        }
+
+        JobHandle JobSystem::Schedule(JobFunction function)
+        {
+            auto counter = std::make_shared<JobCounter>();
+            if (!m_Initialized)
+            {
+                function();
+                return JobHandle(std::move(counter));
+            }
+
+            // The job keeps the counter alive itself: the handle may already be gone, or be destroyed by a
+            // waiter that returns while Decrement is still resuming the other waiters
+            counter->Increment();
+            Job* job = m_JobPool.Acquire(std::move(function), counter.get(), counter);
+            Submit(job);
+            return JobHandle(std::move(counter));
+        }
+
+        void JobSystem::Wait(const JobCounter& counter)
+        {
+            while (!counter.IsDone())
+            {
+                if (!TryExecuteOne())
+                    std::this_thread::yield();
+            }
+        }
+
+        void JobSystem::Submit(Job* job)
+        {
+            m_PendingJobs.fetch_add(1, std::memory_order_relaxed);
+            // Counted before publishing so a worker that grabs the job never sees the count underflow
+            m_QueuedJobs.fetch_add(1, std::memory_order_relaxed);
+
+            int index = t_WorkerIndex;
+            if (index >= 0)
+            {
+                m_Workers[index]->Queue.Push(std::move(job));
+            }
+            else
+            {
+                std::scoped_lock lock(m_InjectionMutex);
+                m_InjectionQueue.push_back(job);
+            }
+
+            m_WakeEvent.NotifyOne();
+        }
+
+        JobSystem::Job* JobSystem::FindJob(int workerIndex)
+        {
+            // 1. Own deque (LIFO keeps the working set hot)
+            if (workerIndex >= 0)
+            {
+                auto& queue = m_Workers[workerIndex]->Queue;
+                if (!queue.IsEmpty())
+                {
+                    if (auto job = queue.Pop(); job && *job)
+                        return *job;
+                }
+            }
+
+            // 2. Work submitted from outside the pool
+            {
+                std::scoped_lock lock(m_InjectionMutex);
+                if (!m_InjectionQueue.empty())
+                {
+                    Job* job = m_InjectionQueue.front();
+                    m_InjectionQueue.pop_front();
+                    return job;
+                }
+            }
+
+            // 3. Steal, starting from a random victim
+            const uint32_t workerCount = static_cast<uint32_t>(m_Workers.size());
+            if (workerCount == 0)
+                return nullptr;
+
+            const uint32_t start = NextRandom() % workerCount;
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                uint32_t victim = (start + i) % workerCount;
+                if (static_cast<int>(victim) == workerIndex)
+                    continue;
+                if (auto job = m_Workers[victim]->Queue.Steal(); job && *job)
+                    return *job;
+            }
+            return nullptr;
+        }
+
+        bool JobSystem::TryExecuteOne()
+        {
+            Job* job = FindJob(t_WorkerIndex);
+            if (!job)
+                return false;
+            Execute(job);
+            return true;
+        }
+
+        void JobSystem::Execute(Job* job)
+        {
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+            job->Function();
+
+            // Release the job (and whatever its function captured) before signalling the waiter
+            JobCounter* counter = job->Counter;
+            std::shared_ptr<JobCounter> ownedCounter = std::move(job->OwnedCounter);
+            m_JobPool.Release(job);
+            if (counter)
+                counter->Decrement();
+            ownedCounter.reset();
+
+            m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        void JobSystem::WorkerLoop(uint32_t workerIndex)
+        {
+            t_WorkerIndex = static_cast<int>(workerIndex);
+            t_RandomState = (workerIndex + 1) * 2654435761u;
+
+            while (true)
+            {
+                if (TryExecuteOne())
+                    continue;
+
+                // Spin briefly, then park until work is queued or we are shutting down
+                m_WakeEvent.Await([this]()
+                {
+                    return !m_Running.load(std::memory_order_acquire) ||
+                           m_QueuedJobs.load(std::memory_order_acquire) > 0;
+                });
+
+                if (!m_Running.load(std::memory_order_acquire) &&
+                    m_QueuedJobs.load(std::memory_order_acquire) == 0)
+                    break;
+            }
+
+            t_WorkerIndex = -1;
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "lmpch.h"
+#include "Core/Concurrency/EventCount.h"
+#include "Core/Concurrency/LockFreeQueue.h"
+#include "Core/Concurrency/ObjectPool.h"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Node a suspended coroutine links into a JobCounter while it waits for the counter to reach zero
+        struct JobCounterWaiter
+        {
+            JobCounterWaiter* Next = nullptr;
+            std::coroutine_handle<> Handle;
+        };
+
+        // Tracks a group of in-flight jobs. Reaches zero once every job submitted against it has finished.
+        // Coroutines can wait on a counter without blocking a thread; they are resumed on the worker pool
+        // by whoever brings the counter to zero, so the counter must outlive that resumption.
+        class JobCounter
+        {
+        public:
+            JobCounter() = default;
+            JobCounter(const JobCounter&) = delete;
+            JobCounter& operator=(const JobCounter&) = delete;
+
+            bool IsDone() const noexcept { return GetPending() == 0; }
+            uint32_t GetPending() const noexcept { return static_cast<uint32_t>(m_State.load(std::memory_order_acquire) & CountMask); }
+
+            // Manual signalling for work that isn't a job (I/O completions, external threads, ...)
+            void Increment(uint32_t count = 1) noexcept { m_State.fetch_add(count, std::memory_order_relaxed); }
+            void Decrement() noexcept;
+
+            // Register a waiter to be resumed once the counter reaches zero. Returns false when the counter
+            // already was zero and the waiter should continue without suspending.
+            bool AddWaiter(JobCounterWaiter* waiter) noexcept;
+
+        private:
+            static constexpr uint64_t CountMask = 0xFFFFFFFFull;
+            static constexpr uint64_t WaitersFlag = 1ull << 32;
+
+            // Detach the waiter list and schedule every waiter except skip; returns whether skip was in it
+            bool ResumeWaiters(JobCounterWaiter* skip) noexcept;
+
+            // Pending count in the low 32 bits, WaitersFlag set while m_Waiters may be non-empty
+            std::atomic<uint64_t> m_State{ 0 };
+            std::atomic<JobCounterWaiter*> m_Waiters{ nullptr };
+        };
+
+        // Owning handle to a job's counter, for callers that don't want to manage a JobCounter themselves
+        class JobHandle
+        {
+        public:
+            JobHandle() = default;
+
+            bool IsValid() const noexcept { return static_cast<bool>(m_Counter); }
+            bool IsDone() const noexcept { return !m_Counter || m_Counter->IsDone(); }
+
+            // Block until the job has finished, executing other pending jobs meanwhile
+            void Wait() const;
+
+        private:
+            friend class JobSystem;
+            explicit JobHandle(std::shared_ptr<JobCounter> counter) : m_Counter(std::move(counter)) {}
+
+            std::shared_ptr<JobCounter> m_Counter;
+        };
+
+        using JobFunction = std::function<void()>;
+
+        // Work-stealing job scheduler. Each worker owns a deque it pushes/pops at the bottom;
+        // idle workers steal from the top of a random victim. Jobs submitted from non-worker
+        // threads go through a shared injection queue.
+        class JobSystem
+        {
+        public:
+            static JobSystem& Get();
+
+            // Start the worker threads. A workerCount of 0 sizes the pool from the logical core count.
+            // Safe to call multiple times; subsequent calls are no-ops.
+            void Initialize(uint32_t workerCount = 0);
+
+            // Drain outstanding jobs and join all workers.
+            void Shutdown();
+
+            bool IsInitialized() const noexcept { return m_Initialized; }
+            uint32_t GetWorkerCount() const noexcept { return static_cast<uint32_t>(m_Workers.size()); }
+
+            // Submit a job. When a counter is given it is incremented now and decremented once the job has run.
+            // Before Initialize (or after Shutdown) jobs execute inline on the calling thread.
+            void Run(JobFunction function, JobCounter* counter = nullptr);
+
+            // Submit a job and get a handle to wait on. The job holds its own reference to the counter, so
+            // the handle may be dropped; discard it explicitly for fire-and-forget work.
+            [[nodiscard]] JobHandle Schedule(JobFunction function);
+
+            // Block until the counter reaches zero. The calling thread executes pending jobs while it waits,
+            // so it is safe to wait from inside a job.
+            void Wait(const JobCounter& counter);
+
+            // Invoke fn(index) for every index in [0, count), split into jobs of batchSize indices. Blocks until done.
+            template<typename Fn>
+            void ParallelFor(uint32_t count, uint32_t batchSize, Fn&& fn)
+            {
+                if (count == 0)
+                    return;
+                if (batchSize == 0)
+                    batchSize = 1;
+
+                JobCounter counter;
+                for (uint32_t begin = 0; begin < count; begin += batchSize)
+                {
+                    uint32_t end = count - begin > batchSize ? begin + batchSize : count;
+                    Run([&fn, begin, end]()
+                    {
+                        for (uint32_t i = begin; i < end; ++i)
+                            fn(i);
+                    }, &counter);
+                }
+                Wait(counter);
+            }
+
+            // Run every callable in parallel and block until all have returned
+            template<typename... Fns>
+            void ParallelInvoke(Fns&&... fns)
+            {
+                JobCounter counter;
+                (Run([&fns]() { fns(); }, &counter), ...);
+                Wait(counter);
+            }
+
+            // Index of the calling worker thread, or -1 when called from a non-worker thread
+            static int GetCurrentWorkerIndex() noexcept;
+
+        private:
+            JobSystem() = default;
+            ~JobSystem();
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            struct Job
+            {
+                JobFunction Function;
+                JobCounter* Counter = nullptr;
+                std::shared_ptr<JobCounter> OwnedCounter;   // Set by Schedule; released after Decrement returns
+            };
+
+            struct Worker
+            {
+                WorkStealingQueue<Job*> Queue;
+                std::thread Thread;
+            };
+
+            void WorkerLoop(uint32_t workerIndex);
+            void Submit(Job* job);
+            Job* FindJob(int workerIndex);
+            bool TryExecuteOne();
+            void Execute(Job* job);
+
+        private:
+            bool m_Initialized = false;
+            std::vector<std::unique_ptr<Worker>> m_Workers;
+            ObjectPool<Job> m_JobPool;
+
+            // Submissions from threads that don't own a worker deque
+            std::mutex m_InjectionMutex;
+            std::deque<Job*> m_InjectionQueue;
+
+            // Idle workers park here; submitters only pay for a wake when someone is parked
+            EventCount m_WakeEvent;
+            std::atomic<bool> m_Running{ false };
+
+            alignas(64) std::atomic<uint32_t> m_QueuedJobs{ 0 };   // Submitted but not yet picked up
+            alignas(64) std::atomic<uint32_t> m_PendingJobs{ 0 };  // Submitted but not yet finished
+        };
+    }
+}
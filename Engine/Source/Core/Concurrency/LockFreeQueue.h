@@ -1,11 +1,18 @@
 #pragma once
 
+#include "Core/Concurrency/Epoch.h"
+#include "Core/Concurrency/EventCount.h"
+
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <array>
 #include <cstddef>
 #include <type_traits>
 #include <optional>
+#include <new>
+#include <cstdint>
+#include <vector>
 
 namespace Limitless
 {
@@ -20,6 +27,8 @@ namespace Limitless
             static_assert(std::is_nothrow_move_assignable_v<T>, "T must be nothrow move assignable");
 
         public:
+            using ValueType = T;
+
             LockFreeSPSCQueue() : m_Head(0), m_Tail(0) {}
 
             // Try to push an item to the queue (thread-safe)
@@ -83,70 +92,191 @@ namespace Limitless
             std::atomic<size_t> m_Tail;
         };
 
-        // Lock-free multi-producer multi-consumer queue using CAS operations
+        // Bounded lock-free multi-producer multi-consumer queue (Vyukov ring).
+        // Every slot carries a sequence number that says whose turn it is: a producer may fill slot
+        // (pos & mask) once its sequence equals pos, a consumer may drain it once it equals pos + 1.
+        // Claiming a position and publishing the item are separate steps, so a consumer can never
+        // observe a claimed slot before its value has been written.
         template<typename T, size_t Size>
         class LockFreeMPMCQueue
         {
-            static_assert(Size > 0 && ((Size & (Size - 1)) == 0), "Size must be a power of 2");
+            static_assert(Size > 1 && ((Size & (Size - 1)) == 0), "Size must be a power of 2");
             static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow move constructible");
             static_assert(std::is_nothrow_move_assignable_v<T>, "T must be nothrow move assignable");
 
         public:
-            LockFreeMPMCQueue() : m_Head(0), m_Tail(0) {}
+            using ValueType = T;
+
+            LockFreeMPMCQueue() : m_Head(0), m_Tail(0)
+            {
+                for (size_t i = 0; i < Size; ++i)
+                    m_Buffer[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+
+            ~LockFreeMPMCQueue()
+            {
+                Clear();
+            }
+
+            LockFreeMPMCQueue(const LockFreeMPMCQueue&) = delete;
+            LockFreeMPMCQueue& operator=(const LockFreeMPMCQueue&) = delete;
 
             // Try to push an item to the queue (thread-safe, multiple producers)
             bool TryPush(T&& item) noexcept
             {
-                size_t currentTail = m_Tail.load(std::memory_order_relaxed);
-                size_t nextTail = (currentTail + 1) & (Size - 1);
-                
-                // Check if queue is full
-                if (nextTail == m_Head.load(std::memory_order_acquire))
-                    return false;
-                
-                // Try to reserve the slot
-                if (!m_Tail.compare_exchange_weak(currentTail, nextTail, 
-                                                 std::memory_order_release, 
-                                                 std::memory_order_relaxed))
-                    return false;
-                
-                // Store the item
-                m_Buffer[currentTail] = std::move(item);
-                return true;
+                size_t pos = m_Tail.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Slot& slot = m_Buffer[pos & (Size - 1)];
+                    size_t seq = slot.Sequence.load(std::memory_order_acquire);
+                    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                    if (diff == 0)
+                    {
+                        // Slot is free for this position; claim it (on failure pos is reloaded)
+                        if (m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            new (slot.Storage) T(std::move(item));
+                            slot.Sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false; // Queue is full
+                    }
+                    else
+                    {
+                        pos = m_Tail.load(std::memory_order_relaxed); // Another producer got here first
+                    }
+                }
             }
 
             // Try to pop an item from the queue (thread-safe, multiple consumers)
             std::optional<T> TryPop() noexcept
             {
-                size_t currentHead = m_Head.load(std::memory_order_relaxed);
-                
-                // Check if queue is empty
-                if (currentHead == m_Tail.load(std::memory_order_acquire))
-                    return std::nullopt;
-                
-                // Try to reserve the slot
-                size_t nextHead = (currentHead + 1) & (Size - 1);
-                if (!m_Head.compare_exchange_weak(currentHead, nextHead,
-                                                 std::memory_order_release,
-                                                 std::memory_order_relaxed))
-                    return std::nullopt;
-                
-                // Load the item
-                T item = std::move(m_Buffer[currentHead]);
-                return std::move(item);
+                size_t pos = m_Head.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Slot& slot = m_Buffer[pos & (Size - 1)];
+                    size_t seq = slot.Sequence.load(std::memory_order_acquire);
+                    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                    if (diff == 0)
+                    {
+                        if (m_Head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            std::optional<T> item(std::move(*slot.Get()));
+                            slot.Get()->~T();
+                            slot.Sequence.store(pos + Size, std::memory_order_release);
+                            return item;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return std::nullopt; // Queue is empty (or the next item is still being written)
+                    }
+                    else
+                    {
+                        pos = m_Head.load(std::memory_order_relaxed); // Another consumer got here first
+                    }
+                }
+            }
+
+            // Push up to count items with a single claim on the tail. Items are moved from the front
+            // of the range; returns how many were pushed (fewer than count when the queue fills up).
+            size_t TryPushBulk(T* items, size_t count) noexcept
+            {
+                if (count == 0)
+                    return 0;
+
+                size_t pos = m_Tail.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    // Count how many consecutive slots from pos are free for this lap
+                    size_t available = 0;
+                    while (available < count && available < Size)
+                    {
+                        const Slot& slot = m_Buffer[(pos + available) & (Size - 1)];
+                        if (slot.Sequence.load(std::memory_order_acquire) != pos + available)
+                            break;
+                        ++available;
+                    }
+
+                    if (available == 0)
+                    {
+                        size_t seq = m_Buffer[pos & (Size - 1)].Sequence.load(std::memory_order_acquire);
+                        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) < 0)
+                            return 0; // Queue is full
+                        pos = m_Tail.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    // A free slot stays free until its producer fills it, so owning the range is enough
+                    if (m_Tail.compare_exchange_weak(pos, pos + available, std::memory_order_relaxed))
+                    {
+                        for (size_t i = 0; i < available; ++i)
+                        {
+                            Slot& slot = m_Buffer[(pos + i) & (Size - 1)];
+                            new (slot.Storage) T(std::move(items[i]));
+                            slot.Sequence.store(pos + i + 1, std::memory_order_release);
+                        }
+                        return available;
+                    }
+                }
+            }
+
+            // Pop up to maxCount items with a single claim on the head, move-assigning them into out.
+            // Returns how many were popped.
+            size_t TryPopBulk(T* out, size_t maxCount) noexcept
+            {
+                if (maxCount == 0)
+                    return 0;
+
+                size_t pos = m_Head.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    // Count how many consecutive slots from pos have been published
+                    size_t available = 0;
+                    while (available < maxCount && available < Size)
+                    {
+                        const Slot& slot = m_Buffer[(pos + available) & (Size - 1)];
+                        if (slot.Sequence.load(std::memory_order_acquire) != pos + available + 1)
+                            break;
+                        ++available;
+                    }
+
+                    if (available == 0)
+                    {
+                        size_t seq = m_Buffer[pos & (Size - 1)].Sequence.load(std::memory_order_acquire);
+                        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0)
+                            return 0; // Queue is empty
+                        pos = m_Head.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (m_Head.compare_exchange_weak(pos, pos + available, std::memory_order_relaxed))
+                    {
+                        for (size_t i = 0; i < available; ++i)
+                        {
+                            Slot& slot = m_Buffer[(pos + i) & (Size - 1)];
+                            out[i] = std::move(*slot.Get());
+                            slot.Get()->~T();
+                            slot.Sequence.store(pos + i + Size, std::memory_order_release);
+                        }
+                        return available;
+                    }
+                }
             }
 
             // Check if queue is empty
             bool IsEmpty() const noexcept
             {
-                return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+                return GetSize() == 0;
             }
 
             // Check if queue is full
             bool IsFull() const noexcept
             {
-                size_t nextTail = (m_Tail.load(std::memory_order_acquire) + 1) & (Size - 1);
-                return nextTail == m_Head.load(std::memory_order_acquire);
+                return GetSize() >= Size;
             }
 
             // Get approximate size (not exact due to concurrent access)
@@ -154,157 +284,299 @@ namespace Limitless
             {
                 size_t head = m_Head.load(std::memory_order_acquire);
                 size_t tail = m_Tail.load(std::memory_order_acquire);
-                return (tail - head) & (Size - 1);
+                return tail > head ? tail - head : 0;
             }
 
+            static constexpr size_t GetCapacity() noexcept { return Size; }
+
             // Clear the queue (not thread-safe, use with caution)
             void Clear() noexcept
             {
-                m_Head.store(0, std::memory_order_relaxed);
-                m_Tail.store(0, std::memory_order_relaxed);
+                while (TryPop())
+                {
+                }
             }
 
         private:
-            alignas(64) std::array<T, Size> m_Buffer; // Cache line aligned
-            alignas(64) std::atomic<size_t> m_Head;   // Cache line aligned
-            alignas(64) std::atomic<size_t> m_Tail;   // Cache line aligned
+            struct Slot
+            {
+                std::atomic<size_t> Sequence;
+                alignas(T) unsigned char Storage[sizeof(T)];
+
+                T* Get() noexcept { return std::launder(reinterpret_cast<T*>(Storage)); }
+            };
+
+            alignas(64) std::array<Slot, Size> m_Buffer; // Cache line aligned
+            alignas(64) std::atomic<size_t> m_Head;      // Cache line aligned
+            alignas(64) std::atomic<size_t> m_Tail;      // Cache line aligned
         };
 
-        // Thread-safe object pool for frequently allocated objects
-        template<typename T, size_t PoolSize = 64>
-        class ObjectPool
+        // Optional blocking front end for the bounded queues above (LockFreeSPSCQueue, LockFreeMPMCQueue).
+        // Try* calls stay non-blocking but wake parked threads; Push/Pop/PopFor spin briefly and then park
+        // on an EventCount, so idle consumers cost nothing between frames and producers skip the wake
+        // syscall while nobody is parked. Thread roles are those of the underlying queue.
+        template<typename Queue>
+        class BlockingQueue
         {
         public:
-            ObjectPool() = default;
-            ~ObjectPool() = default;
+            using ValueType = typename Queue::ValueType;
+
+            BlockingQueue() = default;
+            BlockingQueue(const BlockingQueue&) = delete;
+            BlockingQueue& operator=(const BlockingQueue&) = delete;
 
-            // Get an object from the pool or create a new one
-            std::unique_ptr<T> Acquire() noexcept
+            bool TryPush(ValueType&& item) noexcept
             {
-                std::unique_ptr<T> obj = TryPopFromPool();
-                if (!obj)
-                {
-                    obj = std::make_unique<T>();
-                }
-                return obj;
+                if (!m_Queue.TryPush(std::move(item)))
+                    return false;
+                m_NotEmpty.NotifyOne();
+                return true;
             }
 
-            // Return an object to the pool
-            void Release(std::unique_ptr<T> obj) noexcept
+            std::optional<ValueType> TryPop() noexcept
             {
-                if (obj && TryPushToPool(std::move(obj)))
-                {
-                    // Successfully returned to pool
-                }
-                // If pool is full, object will be automatically destroyed
+                std::optional<ValueType> item = m_Queue.TryPop();
+                if (item)
+                    m_NotFull.NotifyOne();
+                return item;
             }
 
-            // Clear the pool
-            void Clear() noexcept
+            // Push, blocking while the queue is full
+            void Push(ValueType&& item)
             {
-                m_Pool.Clear();
+                // TryPush only moves from item when it succeeds
+                m_NotFull.Await([&]() { return m_Queue.TryPush(std::move(item)); });
+                m_NotEmpty.NotifyOne();
             }
 
-        private:
-            bool TryPushToPool(std::unique_ptr<T> obj) noexcept
+            // Pop, blocking while the queue is empty
+            ValueType Pop()
+            {
+                std::optional<ValueType> item;
+                m_NotEmpty.Await([&]() { item = m_Queue.TryPop(); return item.has_value(); });
+                m_NotFull.NotifyOne();
+                return std::move(*item);
+            }
+
+            // Pop, blocking for at most timeout. Returns nullopt if nothing arrived in time.
+            template<typename Rep, typename Period>
+            std::optional<ValueType> PopFor(std::chrono::duration<Rep, Period> timeout)
+            {
+                std::optional<ValueType> item;
+                bool popped = m_NotEmpty.AwaitFor([&]() { item = m_Queue.TryPop(); return item.has_value(); },
+                                                  std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+                if (popped)
+                    m_NotFull.NotifyOne();
+                return item;
+            }
+
+            size_t TryPushBulk(ValueType* items, size_t count) noexcept
+                requires requires(Queue& q) { q.TryPushBulk(items, count); }
             {
-                return m_Pool.TryPush(std::move(obj));
+                size_t pushed = m_Queue.TryPushBulk(items, count);
+                if (pushed == 1)
+                    m_NotEmpty.NotifyOne();
+                else if (pushed > 1)
+                    m_NotEmpty.NotifyAll();
+                return pushed;
             }
 
-            std::unique_ptr<T> TryPopFromPool() noexcept
+            size_t TryPopBulk(ValueType* out, size_t maxCount) noexcept
+                requires requires(Queue& q) { q.TryPopBulk(out, maxCount); }
             {
-                auto result = m_Pool.TryPop();
-                return result ? std::move(*result) : nullptr;
+                size_t popped = m_Queue.TryPopBulk(out, maxCount);
+                if (popped == 1)
+                    m_NotFull.NotifyOne();
+                else if (popped > 1)
+                    m_NotFull.NotifyAll();
+                return popped;
             }
 
-            LockFreeSPSCQueue<std::unique_ptr<T>, PoolSize> m_Pool;
+            bool IsEmpty() const noexcept { return m_Queue.IsEmpty(); }
+            bool IsFull() const noexcept { return m_Queue.IsFull(); }
+            size_t GetSize() const noexcept { return m_Queue.GetSize(); }
+
+        private:
+            Queue m_Queue;
+            EventCount m_NotEmpty;
+            EventCount m_NotFull;
         };
 
-        // Thread-safe work stealing queue for task scheduling
-        template<typename T, size_t Size = 1024>
+        // Growable Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli - PPoPP '13).
+        // The owner thread pushes and pops at the bottom; any other thread may steal from the top.
+        // When the ring is full the owner doubles it. Thieves may still be reading the old ring,
+        // so retired rings go to the EpochManager and are freed once no thief can still be reading them.
+        // Small trivially copyable items (pointers, handles) are stored inline; anything else is
+        // boxed on push so move-only and non-default-constructible job types work too.
+        template<typename T, size_t InitialSize = 1024>
         class WorkStealingQueue
         {
+            static_assert(InitialSize > 1 && ((InitialSize & (InitialSize - 1)) == 0), "InitialSize must be a power of 2");
+            static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow move constructible");
+
+            static constexpr bool StoreInline = std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(void*);
+            using Slot = std::conditional_t<StoreInline, T, T*>;
+
         public:
-            WorkStealingQueue() : m_Bottom(0), m_Top(0) {}
+            WorkStealingQueue() : m_Bottom(0), m_Top(0), m_Buffer(new Buffer(InitialSize)) {}
 
-            // Push item to the bottom (owner thread only)
-            void Push(T&& item) noexcept
+            ~WorkStealingQueue()
             {
-                size_t bottom = m_Bottom.load(std::memory_order_relaxed);
-                m_Buffer[bottom & (Size - 1)] = std::move(item);
-                m_Bottom.store(bottom + 1, std::memory_order_release);
+                while (Pop())
+                {
+                }
+                delete m_Buffer.load(std::memory_order_relaxed);
+            }
+
+            WorkStealingQueue(const WorkStealingQueue&) = delete;
+            WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+            // Push item to the bottom (owner thread only). Grows the ring instead of overwriting.
+            void Push(T&& item)
+            {
+                int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+                int64_t top = m_Top.load(std::memory_order_acquire);
+                Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+                if (bottom - top > static_cast<int64_t>(buffer->Mask))
+                    buffer = Grow(buffer, top, bottom);
+
+                buffer->Store(bottom, Wrap(std::move(item)));
+                // Publish the slot before the new bottom becomes visible to thieves
+                std::atomic_thread_fence(std::memory_order_release);
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
             }
 
             // Pop item from the bottom (owner thread only)
             std::optional<T> Pop() noexcept
             {
-                size_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+                int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+                Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
                 m_Bottom.store(bottom, std::memory_order_relaxed);
-                
-                size_t top = m_Top.load(std::memory_order_acquire);
+                // The bottom store must be visible before reading top, otherwise owner and thief can take the same item
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t top = m_Top.load(std::memory_order_relaxed);
+
                 if (top > bottom)
                 {
+                    // Empty
                     m_Bottom.store(bottom + 1, std::memory_order_relaxed);
                     return std::nullopt;
                 }
-                
-                T item = std::move(m_Buffer[bottom & (Size - 1)]);
-                
+
+                Slot slot = buffer->Load(bottom);
                 if (top == bottom)
                 {
-                    if (!m_Top.compare_exchange_strong(top, top + 1,
-                                                      std::memory_order_seq_cst,
-                                                      std::memory_order_relaxed))
-                    {
-                        item = T{}; // Failed to steal
-                    }
+                    // Last item: race the thieves for it
+                    bool won = m_Top.compare_exchange_strong(top, top + 1,
+                                                             std::memory_order_seq_cst,
+                                                             std::memory_order_relaxed);
                     m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                    if (!won)
+                        return std::nullopt;
                 }
-                
-                return std::move(item);
+                return Unwrap(slot);
             }
 
-            // Steal item from the top (other threads)
+            // Steal item from the top (other threads). Returns nullopt when empty or when another thread won the race.
             std::optional<T> Steal() noexcept
             {
-                size_t top = m_Top.load(std::memory_order_acquire);
-                size_t bottom = m_Bottom.load(std::memory_order_acquire);
-                
+                int64_t top = m_Top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
                 if (top >= bottom)
                     return std::nullopt;
-                
-                T item = std::move(m_Buffer[top & (Size - 1)]);
-                
+
+                // Read the slot before claiming it; the value is only used if the claim succeeds.
+                // The pin keeps the buffer alive if the owner grows and retires it meanwhile.
+                Slot slot;
+                {
+                    EpochManager::Guard guard;
+                    Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+                    slot = buffer->Load(top);
+                }
                 if (!m_Top.compare_exchange_strong(top, top + 1,
-                                                  std::memory_order_seq_cst,
-                                                  std::memory_order_relaxed))
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed))
                 {
                     return std::nullopt;
                 }
-                
-                return std::move(item);
+                return Unwrap(slot);
             }
 
             // Check if queue is empty
             bool IsEmpty() const noexcept
             {
-                size_t top = m_Top.load(std::memory_order_acquire);
-                size_t bottom = m_Bottom.load(std::memory_order_acquire);
+                int64_t top = m_Top.load(std::memory_order_acquire);
+                int64_t bottom = m_Bottom.load(std::memory_order_acquire);
                 return top >= bottom;
             }
 
             // Get approximate size
             size_t GetSize() const noexcept
             {
-                size_t top = m_Top.load(std::memory_order_acquire);
-                size_t bottom = m_Bottom.load(std::memory_order_acquire);
-                return bottom > top ? bottom - top : 0;
+                int64_t top = m_Top.load(std::memory_order_acquire);
+                int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+                return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+            }
+
+            // Current ring capacity (owner thread only)
+            size_t GetCapacity() const noexcept
+            {
+                return m_Buffer.load(std::memory_order_relaxed)->Mask + 1;
+            }
+
+        private:
+            struct Buffer
+            {
+                explicit Buffer(size_t capacity) : Mask(capacity - 1), Slots(new std::atomic<Slot>[capacity]) {}
+
+                Slot Load(int64_t index) const noexcept { return Slots[static_cast<size_t>(index) & Mask].load(std::memory_order_relaxed); }
+                void Store(int64_t index, Slot value) noexcept { Slots[static_cast<size_t>(index) & Mask].store(value, std::memory_order_relaxed); }
+
+                size_t Mask;
+                std::unique_ptr<std::atomic<Slot>[]> Slots;
+            };
+
+            Buffer* Grow(Buffer* old, int64_t top, int64_t bottom)
+            {
+                Buffer* grown = new Buffer((old->Mask + 1) * 2);
+                for (int64_t i = top; i < bottom; ++i)
+                    grown->Store(i, old->Load(i));
+
+                m_Buffer.store(grown, std::memory_order_release);
+                // Thieves may still be reading the old ring
+                EpochManager::Get().Retire(old);
+                return grown;
+            }
+
+            static Slot Wrap(T&& item)
+            {
+                if constexpr (StoreInline)
+                    return item;
+                else
+                    return new T(std::move(item));
+            }
+
+            static std::optional<T> Unwrap(Slot slot) noexcept
+            {
+                if constexpr (StoreInline)
+                {
+                    return slot;
+                }
+                else
+                {
+                    std::optional<T> item(std::move(*slot));
+                    delete slot;
+                    return item;
+                }
             }
 
         private:
-            alignas(64) std::array<T, Size> m_Buffer;
-            alignas(64) std::atomic<size_t> m_Bottom;
-            alignas(64) std::atomic<size_t> m_Top;
+            alignas(64) std::atomic<int64_t> m_Bottom;
+            alignas(64) std::atomic<int64_t> m_Top;
+            alignas(64) std::atomic<Buffer*> m_Buffer;
         };
     }
 } 
\ No newline at end of file
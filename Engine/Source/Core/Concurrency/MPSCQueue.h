@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/Concurrency/ObjectPool.h"
+
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Link embedded in every node of an IntrusiveMPSCQueue
+        struct MPSCNode
+        {
+            std::atomic<MPSCNode*> Next{ nullptr };
+        };
+
+        // Unbounded intrusive multi-producer single-consumer queue (Vyukov).
+        // Push is wait-free: one exchange and one store. The queue never owns its nodes; callers
+        // embed MPSCNode in their own type and manage its lifetime.
+        class IntrusiveMPSCQueue
+        {
+        public:
+            IntrusiveMPSCQueue() : m_Head(&m_Stub), m_Tail(&m_Stub) {}
+
+            IntrusiveMPSCQueue(const IntrusiveMPSCQueue&) = delete;
+            IntrusiveMPSCQueue& operator=(const IntrusiveMPSCQueue&) = delete;
+
+            // Append a node (thread-safe, any number of producers)
+            void Push(MPSCNode* node) noexcept
+            {
+                node->Next.store(nullptr, std::memory_order_relaxed);
+                MPSCNode* previous = m_Head.exchange(node, std::memory_order_acq_rel);
+                // Between the exchange and this store the chain is briefly broken; Pop treats that as empty
+                previous->Next.store(node, std::memory_order_release);
+            }
+
+            // Remove the oldest node (consumer thread only). Returns nullptr when empty, or when the
+            // oldest node's producer is still between its two steps above.
+            MPSCNode* Pop() noexcept
+            {
+                MPSCNode* tail = m_Tail;
+                MPSCNode* next = tail->Next.load(std::memory_order_acquire);
+
+                if (tail == &m_Stub)
+                {
+                    if (!next)
+                        return nullptr;
+                    m_Tail = next;
+                    tail = next;
+                    next = next->Next.load(std::memory_order_acquire);
+                }
+
+                if (next)
+                {
+                    m_Tail = next;
+                    return tail;
+                }
+
+                if (tail != m_Head.load(std::memory_order_acquire))
+                    return nullptr; // A producer is mid-push
+
+                // tail is the last node: re-insert the stub behind it so tail can be handed out
+                Push(&m_Stub);
+                next = tail->Next.load(std::memory_order_acquire);
+                if (next)
+                {
+                    m_Tail = next;
+                    return tail;
+                }
+                return nullptr;
+            }
+
+            // Approximate; only meaningful from the consumer thread
+            bool IsEmpty() const noexcept
+            {
+                return m_Tail == &m_Stub && m_Stub.Next.load(std::memory_order_acquire) == nullptr;
+            }
+
+        private:
+            alignas(64) std::atomic<MPSCNode*> m_Head; // Producers
+            alignas(64) MPSCNode* m_Tail;              // Consumer
+            MPSCNode m_Stub;
+        };
+
+        // Unbounded MPSC queue of values. Nodes come from a thread-caching ObjectPool, so steady-state
+        // pushes don't touch the heap and nothing is ever dropped for lack of space.
+        template<typename T>
+        class MPSCQueue
+        {
+            static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow move constructible");
+
+        public:
+            using ValueType = T;
+
+            MPSCQueue() = default;
+
+            ~MPSCQueue()
+            {
+                while (TryPop())
+                {
+                }
+            }
+
+            MPSCQueue(const MPSCQueue&) = delete;
+            MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+            // Push an item (thread-safe, multiple producers). Never fails.
+            void Push(T&& item)
+            {
+                Node* node = m_Pool.Acquire(std::move(item));
+                m_Queue.Push(node);
+            }
+
+            // Pop the oldest item (consumer thread only)
+            std::optional<T> TryPop() noexcept
+            {
+                MPSCNode* link = m_Queue.Pop();
+                if (!link)
+                    return std::nullopt;
+
+                Node* node = static_cast<Node*>(link);
+                std::optional<T> item(std::move(node->Value));
+                m_Pool.Release(node);
+                return item;
+            }
+
+            // Consumer thread only
+            bool IsEmpty() const noexcept { return m_Queue.IsEmpty(); }
+
+        private:
+            struct Node : MPSCNode
+            {
+                explicit Node(T&& value) noexcept : Value(std::move(value)) {}
+                T Value;
+            };
+
+            IntrusiveMPSCQueue m_Queue;
+            ObjectPool<Node> m_Pool;
+        };
+    }
+}
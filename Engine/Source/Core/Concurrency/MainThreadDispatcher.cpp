@@ -0,0 +1,100 @@
+#include "lmpch.h"
+#include "Core/Concurrency/MainThreadDispatcher.h"
+#include "Core/Log.h"
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        MainThreadDispatcher& MainThreadDispatcher::Get()
+        {
+            static MainThreadDispatcher instance;
+            return instance;
+        }
+
+        void MainThreadDispatcher::Post(Callback callback)
+        {
+            m_Pending.fetch_add(1, std::memory_order_relaxed);
+            m_Queue.Push(std::move(callback));
+        }
+
+        void MainThreadDispatcher::Dispatch(Callback callback)
+        {
+            if (IsMainThread())
+                callback();
+            else
+                Post(std::move(callback));
+        }
+
+        void MainThreadDispatcher::PostNextFrame(Callback callback)
+        {
+            m_NextFramePending.fetch_add(1, std::memory_order_relaxed);
+            m_NextFrameQueue.Push(std::move(callback));
+        }
+
+        size_t MainThreadDispatcher::BeginFrame()
+        {
+            LM_ASSERT_MSG(IsMainThread(), "MainThreadDispatcher frame started from a non-main thread");
+
+            // Only what was queued before now; the queue is FIFO so later posts stay behind this snapshot
+            size_t count = m_NextFramePending.load(std::memory_order_acquire);
+            size_t executed = 0;
+            while (executed < count)
+            {
+                auto callback = m_NextFrameQueue.TryPop();
+                if (!callback)
+                    break;
+                m_NextFramePending.fetch_sub(1, std::memory_order_relaxed);
+                (*callback)();
+                ++executed;
+            }
+            return executed;
+        }
+
+        size_t MainThreadDispatcher::Drain(std::chrono::microseconds budget)
+        {
+            LM_ASSERT_MSG(IsMainThread(), "MainThreadDispatcher drained from a non-main thread");
+
+            using Clock = std::chrono::steady_clock;
+            const auto deadline = Clock::now() + budget;
+
+            size_t executed = 0;
+            while (auto callback = m_Queue.TryPop())
+            {
+                m_Pending.fetch_sub(1, std::memory_order_relaxed);
+                (*callback)();
+                ++executed;
+
+                if (Clock::now() >= deadline)
+                    break;
+            }
+            return executed;
+        }
+
+        size_t MainThreadDispatcher::DrainAll()
+        {
+            LM_ASSERT_MSG(IsMainThread(), "MainThreadDispatcher drained from a non-main thread");
+
+            size_t executed = 0;
+            for (;;)
+            {
+                if (auto callback = m_Queue.TryPop())
+                {
+                    m_Pending.fetch_sub(1, std::memory_order_relaxed);
+                    (*callback)();
+                }
+                else if (auto nextFrame = m_NextFrameQueue.TryPop())
+                {
+                    m_NextFramePending.fetch_sub(1, std::memory_order_relaxed);
+                    (*nextFrame)();
+                }
+                else
+                {
+                    break;
+                }
+                ++executed;
+            }
+            return executed;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "lmpch.h"
+#include "Core/Concurrency/MPSCQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Runs callbacks on the main thread. Work that must stay on the thread that owns the window and
+        // SDL_Renderer is posted here from any thread and executed when Application::Run drains the
+        // queue once per frame. Draining stops when the frame budget is spent; leftovers run next frame.
+        class MainThreadDispatcher
+        {
+        public:
+            using Callback = std::function<void()>;
+
+            static MainThreadDispatcher& Get();
+
+            // Record the calling thread as the main thread (Application::Run does this)
+            void SetMainThread() noexcept { m_MainThread = std::this_thread::get_id(); }
+            bool IsMainThread() const noexcept { return std::this_thread::get_id() == m_MainThread; }
+
+            // Queue a callback for the next drain. Thread-safe, never blocks, never drops.
+            void Post(Callback callback);
+
+            // Run immediately when called on the main thread, otherwise Post
+            void Dispatch(Callback callback);
+
+            // Queue a callback for the start of the next frame rather than this frame's drain
+            void PostNextFrame(Callback callback);
+
+            // Run the callbacks posted with PostNextFrame before this call (main thread only, once per frame).
+            // Anything they post in turn waits for the following frame. Returns the number executed.
+            size_t BeginFrame();
+
+            // Execute queued callbacks until the queue is empty or budget has elapsed (main thread only).
+            // At least one callback runs per call so a slow callback can't starve the rest forever.
+            // Returns the number of callbacks executed.
+            size_t Drain(std::chrono::microseconds budget);
+
+            // Drain with the configured per-frame budget
+            size_t DrainFrame() { return Drain(m_FrameBudget); }
+
+            // Run everything that is queued, next-frame callbacks included, ignoring the budget (used at shutdown)
+            size_t DrainAll();
+
+            void SetFrameBudget(std::chrono::microseconds budget) noexcept { m_FrameBudget = budget; }
+            std::chrono::microseconds GetFrameBudget() const noexcept { return m_FrameBudget; }
+
+            // Approximate number of callbacks waiting to run
+            size_t GetPendingCount() const noexcept { return m_Pending.load(std::memory_order_relaxed); }
+
+        private:
+            MainThreadDispatcher() = default;
+            MainThreadDispatcher(const MainThreadDispatcher&) = delete;
+            MainThreadDispatcher& operator=(const MainThreadDispatcher&) = delete;
+
+        private:
+            MPSCQueue<Callback> m_Queue;
+            std::atomic<size_t> m_Pending{ 0 };
+            MPSCQueue<Callback> m_NextFrameQueue;
+            std::atomic<size_t> m_NextFramePending{ 0 };
+            std::thread::id m_MainThread = std::this_thread::get_id();
+            std::chrono::microseconds m_FrameBudget{ 2000 };
+        };
+    }
+}
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "Core/Concurrency/ThreadIndex.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Thread-safe object pool for frequently allocated objects.
+        // Objects live in contiguous slabs that are never freed while the pool exists. Each thread keeps a
+        // small magazine of free slots it can use without any atomics; magazines refill from and spill into
+        // a shared lock-free free list (a Treiber stack whose head carries an ABA tag next to the slot index).
+        template<typename T, size_t SlabSize = 64, size_t MagazineSize = 32>
+        class ObjectPool
+        {
+            static_assert(SlabSize > 0 && ((SlabSize & (SlabSize - 1)) == 0), "SlabSize must be a power of 2");
+            static_assert(MagazineSize >= 2, "MagazineSize must be at least 2");
+
+        public:
+            struct Stats
+            {
+                uint64_t Hits = 0;       // Acquires served from a magazine or the shared free list
+                uint64_t Misses = 0;     // Acquires that had to carve a fresh slot from a slab
+                size_t Live = 0;         // Objects currently acquired
+                size_t HighWater = 0;    // Slots ever carved, i.e. the peak storage the pool has needed
+            };
+
+            struct Deleter
+            {
+                ObjectPool* Pool = nullptr;
+                void operator()(T* object) const noexcept { if (Pool) Pool->Release(object); }
+            };
+            using UniquePtr = std::unique_ptr<T, Deleter>;
+
+            ObjectPool() = default;
+
+            ~ObjectPool()
+            {
+                // Objects still acquired are not destroyed; their storage goes away with the slabs
+                for (auto& slab : m_Slabs)
+                {
+                    Node* nodes = slab.load(std::memory_order_relaxed);
+                    if (nodes)
+                        ::operator delete(nodes, std::align_val_t(alignof(Node)));
+                }
+            }
+
+            ObjectPool(const ObjectPool&) = delete;
+            ObjectPool& operator=(const ObjectPool&) = delete;
+
+            // Construct an object in pooled storage
+            template<typename... Args>
+            T* Acquire(Args&&... args)
+            {
+                Node* node = AcquireNode();
+                if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+                {
+                    return new (node->Storage) T(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    try
+                    {
+                        return new (node->Storage) T(std::forward<Args>(args)...);
+                    }
+                    catch (...)
+                    {
+                        ReleaseNode(node);
+                        throw;
+                    }
+                }
+            }
+
+            template<typename... Args>
+            UniquePtr AcquireUnique(Args&&... args)
+            {
+                return UniquePtr(Acquire(std::forward<Args>(args)...), Deleter{ this });
+            }
+
+            // Destroy an object and return its storage to the pool. Any thread may release any object.
+            void Release(T* object) noexcept
+            {
+                if (!object)
+                    return;
+                object->~T();
+                ReleaseNode(reinterpret_cast<Node*>(object));
+            }
+
+            // Hand the calling thread's cached slots back to the shared free list
+            void FlushThreadCache() noexcept
+            {
+                uint32_t thread = ThreadIndex::Get();
+                if (thread == ThreadIndex::InvalidIndex)
+                    return;
+                Magazine& magazine = m_Magazines[thread];
+                if (magazine.Count > 0)
+                {
+                    PushChain(magazine.Items, magazine.Count);
+                    magazine.Count = 0;
+                }
+            }
+
+            // Approximate while other threads are acquiring/releasing
+            Stats GetStats() const noexcept
+            {
+                Stats stats;
+                uint64_t acquired = 0, released = 0;
+                auto accumulate = [&](const Counters& counters)
+                {
+                    stats.Hits += counters.Hits.load(std::memory_order_relaxed);
+                    stats.Misses += counters.Misses.load(std::memory_order_relaxed);
+                    acquired += counters.Acquired.load(std::memory_order_relaxed);
+                    released += counters.Released.load(std::memory_order_relaxed);
+                };
+                for (const Magazine& magazine : m_Magazines)
+                    accumulate(magazine.Counts);
+                accumulate(m_UncachedStats);
+
+                stats.Live = acquired > released ? static_cast<size_t>(acquired - released) : 0;
+                stats.HighWater = m_Carved.load(std::memory_order_relaxed);
+                return stats;
+            }
+
+        private:
+            static constexpr uint32_t NullIndex = ~0u;
+            static constexpr uint32_t MaxSlabs = 32;
+
+            struct Node
+            {
+                alignas(T) unsigned char Storage[sizeof(T)]; // First, so T* and Node* share an address
+                std::atomic<uint32_t> Next{ NullIndex };
+                uint32_t Index = NullIndex;
+            };
+
+            struct Counters
+            {
+                std::atomic<uint64_t> Hits{ 0 };
+                std::atomic<uint64_t> Misses{ 0 };
+                std::atomic<uint64_t> Acquired{ 0 };
+                std::atomic<uint64_t> Released{ 0 };
+            };
+
+            // Touched only by the thread that owns its ThreadIndex
+            struct alignas(64) Magazine
+            {
+                uint32_t Items[MagazineSize];
+                uint32_t Count = 0;
+                Counters Counts;
+            };
+
+            // Owner-only counters: a plain load/store avoids a locked RMW on the hot path
+            static void Bump(std::atomic<uint64_t>& counter) noexcept
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            Node* AcquireNode()
+            {
+                uint32_t thread = ThreadIndex::Get();
+                if (thread == ThreadIndex::InvalidIndex)
+                {
+                    uint32_t index = PopGlobal();
+                    bool hit = index != NullIndex;
+                    if (!hit)
+                        index = Carve();
+                    (hit ? m_UncachedStats.Hits : m_UncachedStats.Misses).fetch_add(1, std::memory_order_relaxed);
+                    m_UncachedStats.Acquired.fetch_add(1, std::memory_order_relaxed);
+                    return GetNode(index);
+                }
+
+                Magazine& magazine = m_Magazines[thread];
+                uint32_t index;
+                if (magazine.Count > 0)
+                {
+                    index = magazine.Items[--magazine.Count];
+                    Bump(magazine.Counts.Hits);
+                }
+                else if ((index = PopGlobal()) != NullIndex)
+                {
+                    // Refill half the magazine so the next few acquires stay thread-local
+                    while (magazine.Count < MagazineSize / 2)
+                    {
+                        uint32_t extra = PopGlobal();
+                        if (extra == NullIndex)
+                            break;
+                        magazine.Items[magazine.Count++] = extra;
+                    }
+                    Bump(magazine.Counts.Hits);
+                }
+                else
+                {
+                    index = Carve();
+                    Bump(magazine.Counts.Misses);
+                }
+                Bump(magazine.Counts.Acquired);
+                return GetNode(index);
+            }
+
+            void ReleaseNode(Node* node) noexcept
+            {
+                uint32_t thread = ThreadIndex::Get();
+                if (thread == ThreadIndex::InvalidIndex)
+                {
+                    PushChain(&node->Index, 1);
+                    m_UncachedStats.Released.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                Magazine& magazine = m_Magazines[thread];
+                if (magazine.Count == MagazineSize)
+                {
+                    // Spill the older half to the shared list in one CAS
+                    constexpr uint32_t Spill = MagazineSize / 2;
+                    PushChain(magazine.Items, Spill);
+                    for (uint32_t i = Spill; i < MagazineSize; ++i)
+                        magazine.Items[i - Spill] = magazine.Items[i];
+                    magazine.Count -= Spill;
+                }
+                magazine.Items[magazine.Count++] = node->Index;
+                Bump(magazine.Counts.Released);
+            }
+
+            // Shared free list --------------------------------------------------------------
+
+            static uint64_t Pack(uint32_t index, uint32_t tag) noexcept
+            {
+                return (static_cast<uint64_t>(tag) << 32) | index;
+            }
+
+            uint32_t PopGlobal() noexcept
+            {
+                uint64_t head = m_FreeHead.load(std::memory_order_acquire);
+                for (;;)
+                {
+                    uint32_t index = static_cast<uint32_t>(head);
+                    if (index == NullIndex)
+                        return NullIndex;
+                    // Slabs are never freed, so reading Next of a node another thread just took is harmless;
+                    // the tag makes our CAS fail in that case
+                    uint32_t next = GetNode(index)->Next.load(std::memory_order_relaxed);
+                    uint64_t desired = Pack(next, static_cast<uint32_t>(head >> 32) + 1);
+                    if (m_FreeHead.compare_exchange_weak(head, desired, std::memory_order_acquire, std::memory_order_acquire))
+                        return index;
+                }
+            }
+
+            // Link indices[0..count) into a chain and push it with a single CAS
+            void PushChain(const uint32_t* indices, uint32_t count) noexcept
+            {
+                for (uint32_t i = 0; i + 1 < count; ++i)
+                    GetNode(indices[i])->Next.store(indices[i + 1], std::memory_order_relaxed);
+
+                Node* last = GetNode(indices[count - 1]);
+                uint64_t head = m_FreeHead.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    last->Next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+                    uint64_t desired = Pack(indices[0], static_cast<uint32_t>(head >> 32) + 1);
+                    if (m_FreeHead.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed))
+                        return;
+                }
+            }
+
+            // Slabs ---------------------------------------------------------------------------
+            // Slab k holds SlabSize << k nodes, so 32 slab pointers cover the whole 32-bit index space.
+
+            static uint32_t SlabOf(uint32_t index) noexcept
+            {
+                return static_cast<uint32_t>(std::bit_width(index / SlabSize + 1)) - 1;
+            }
+
+            static uint32_t SlabStart(uint32_t slab) noexcept
+            {
+                return static_cast<uint32_t>(SlabSize * ((size_t(1) << slab) - 1));
+            }
+
+            Node* GetNode(uint32_t index) const noexcept
+            {
+                uint32_t slab = SlabOf(index);
+                return m_Slabs[slab].load(std::memory_order_acquire) + (index - SlabStart(slab));
+            }
+
+            uint32_t Carve()
+            {
+                uint32_t index = m_Carved.fetch_add(1, std::memory_order_relaxed);
+                uint32_t slab = SlabOf(index);
+                if (index == NullIndex || slab >= MaxSlabs)
+                    throw std::bad_alloc();
+
+                Node* nodes = m_Slabs[slab].load(std::memory_order_acquire);
+                if (!nodes)
+                {
+                    std::scoped_lock lock(m_SlabMutex);
+                    nodes = m_Slabs[slab].load(std::memory_order_relaxed);
+                    if (!nodes)
+                    {
+                        size_t count = size_t(SlabSize) << slab;
+                        nodes = static_cast<Node*>(::operator new(sizeof(Node) * count, std::align_val_t(alignof(Node))));
+                        for (size_t i = 0; i < count; ++i)
+                            new (&nodes[i]) Node();
+                        m_Slabs[slab].store(nodes, std::memory_order_release);
+                    }
+                }
+
+                Node* node = nodes + (index - SlabStart(slab));
+                node->Index = index;
+                return index;
+            }
+
+        private:
+            alignas(64) std::atomic<uint64_t> m_FreeHead{ Pack(NullIndex, 0) };
+            alignas(64) std::atomic<uint32_t> m_Carved{ 0 };
+            std::array<std::atomic<Node*>, MaxSlabs> m_Slabs{};
+            std::mutex m_SlabMutex;
+            Counters m_UncachedStats; // Threads without a ThreadIndex
+            std::array<Magazine, ThreadIndex::MaxThreads> m_Magazines{};
+        };
+    }
+}
@@ -0,0 +1,105 @@
+#include "lmpch.h"
+#include "Core/Concurrency/Task.h"
+#include "Core/Concurrency/ObjectPool.h"
+
+#include <bit>
+#include <tuple>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        namespace Detail
+        {
+            namespace
+            {
+                template<size_t Size>
+                struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameBlock
+                {
+                    FrameBlock() {} // Leave the bytes uninitialized
+                    std::byte Bytes[Size];
+                };
+
+                // Size classes 64, 128, ... 4096 bytes
+                constexpr size_t MinClassShift = 6;
+                constexpr size_t MaxClassShift = 12;
+                constexpr size_t MaxPooledSize = size_t(1) << MaxClassShift;
+
+                template<size_t... Classes>
+                struct FramePools
+                {
+                    std::tuple<ObjectPool<FrameBlock<(size_t(1) << (MinClassShift + Classes))>>...> Pools;
+
+                    void* Allocate(size_t sizeClass)
+                    {
+                        void* frame = nullptr;
+                        ((Classes == sizeClass ? (frame = std::get<Classes>(Pools).Acquire()->Bytes, true) : false) || ...);
+                        return frame;
+                    }
+
+                    void Free(void* frame, size_t sizeClass) noexcept
+                    {
+                        ((Classes == sizeClass ? (Release(std::get<Classes>(Pools), frame), true) : false) || ...);
+                    }
+
+                    template<typename Pool>
+                    static void Release(Pool& pool, void* frame) noexcept
+                    {
+                        using Block = std::remove_pointer_t<decltype(pool.Acquire())>;
+                        pool.Release(static_cast<Block*>(frame));
+                    }
+                };
+
+                template<size_t... Classes>
+                FramePools<Classes...>* MakeFramePools(std::index_sequence<Classes...>)
+                {
+                    return new FramePools<Classes...>();
+                }
+
+                auto& GetFramePools()
+                {
+                    // Intentionally leaked: detached coroutines may still be freeing frames during static destruction
+                    static auto* pools = MakeFramePools(std::make_index_sequence<MaxClassShift - MinClassShift + 1>());
+                    return *pools;
+                }
+
+                size_t GetSizeClass(size_t size) noexcept
+                {
+                    size_t shift = std::bit_width(size - 1);
+                    return shift <= MinClassShift ? 0 : shift - MinClassShift;
+                }
+            }
+
+            void* AllocateCoroutineFrame(size_t size)
+            {
+                if (size > MaxPooledSize)
+                    return ::operator new(size);
+                return GetFramePools().Allocate(GetSizeClass(size));
+            }
+
+            void FreeCoroutineFrame(void* frame, size_t size) noexcept
+            {
+                if (size > MaxPooledSize)
+                    ::operator delete(frame, size);
+                else
+                    GetFramePools().Free(frame, GetSizeClass(size));
+            }
+
+            void DetachedTask::promise_type::unhandled_exception() const noexcept
+            {
+                try
+                {
+                    throw;
+                }
+                catch (const std::exception& e)
+                {
+                    LM_LOG_CAT_ERROR(Concurrency, "Unhandled exception in detached task: {}", e.what());
+                }
+                catch (...)
+                {
+                    LM_LOG_CAT_ERROR(Concurrency, "Unhandled unknown exception in detached task");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+#include "lmpch.h"
+#include "Core/Concurrency/JobSystem.h"
+#include "Core/Concurrency/MainThreadDispatcher.h"
+#include "Core/Log.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        template<typename T = void>
+        class Task;
+
+        namespace Detail
+        {
+            // Coroutine frames are carved from size-class pools; frames bigger than the largest class use the heap
+            void* AllocateCoroutineFrame(size_t size);
+            void FreeCoroutineFrame(void* frame, size_t size) noexcept;
+
+            struct TaskPromiseBase
+            {
+                struct FinalAwaiter
+                {
+                    bool await_ready() const noexcept { return false; }
+
+                    // Symmetric transfer to the awaiting coroutine so long await chains don't grow the stack
+                    template<typename Promise>
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+                    {
+                        std::coroutine_handle<> continuation = handle.promise().Continuation;
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+
+                static void* operator new(size_t size) { return AllocateCoroutineFrame(size); }
+                static void operator delete(void* frame, size_t size) noexcept { FreeCoroutineFrame(frame, size); }
+
+                std::suspend_always initial_suspend() const noexcept { return {}; }
+                FinalAwaiter final_suspend() const noexcept { return {}; }
+                void unhandled_exception() noexcept { Exception = std::current_exception(); }
+
+                void RethrowIfFailed() const
+                {
+                    if (Exception)
+                        std::rethrow_exception(Exception);
+                }
+
+                std::coroutine_handle<> Continuation;
+                std::exception_ptr Exception;
+            };
+
+            template<typename T>
+            struct TaskPromise : TaskPromiseBase
+            {
+                Task<T> get_return_object() noexcept;
+
+                template<typename U>
+                    requires std::is_convertible_v<U&&, T>
+                void return_value(U&& value) { Value.emplace(std::forward<U>(value)); }
+
+                T TakeResult()
+                {
+                    RethrowIfFailed();
+                    return std::move(*Value);
+                }
+
+                std::optional<T> Value;
+            };
+
+            template<>
+            struct TaskPromise<void> : TaskPromiseBase
+            {
+                Task<void> get_return_object() noexcept;
+                void return_void() const noexcept {}
+                void TakeResult() const { RethrowIfFailed(); }
+            };
+
+            // Fire-and-forget coroutine that frees its own frame when it finishes
+            struct DetachedTask
+            {
+                struct promise_type
+                {
+                    static void* operator new(size_t size) { return AllocateCoroutineFrame(size); }
+                    static void operator delete(void* frame, size_t size) noexcept { FreeCoroutineFrame(frame, size); }
+
+                    DetachedTask get_return_object() const noexcept { return {}; }
+                    std::suspend_never initial_suspend() const noexcept { return {}; }
+                    std::suspend_never final_suspend() const noexcept { return {}; }
+                    void return_void() const noexcept {}
+                    void unhandled_exception() const noexcept;
+                };
+            };
+        }
+
+        // Lazily started coroutine producing a T. Nothing runs until the task is awaited (or handed to
+        // Spawn / SyncWait); when it finishes, the awaiting coroutine continues on the same thread.
+        //
+        //     Task<TextureData> LoadTexture(std::string path)
+        //     {
+        //         co_await ResumeOnWorker();
+        //         TextureData data = Decode(ReadFile(path));
+        //         co_await ResumeOnMainThread();
+        //         Upload(data);
+        //         co_return data;
+        //     }
+        template<typename T>
+        class [[nodiscard]] Task
+        {
+        public:
+            using promise_type = Detail::TaskPromise<T>;
+            using Handle = std::coroutine_handle<promise_type>;
+
+            Task() = default;
+            explicit Task(Handle handle) noexcept : m_Handle(handle) {}
+            Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+            Task& operator=(Task&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Destroy();
+                    m_Handle = std::exchange(other.m_Handle, nullptr);
+                }
+                return *this;
+            }
+
+            ~Task() { Destroy(); }
+
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            bool IsValid() const noexcept { return static_cast<bool>(m_Handle); }
+            bool IsDone() const noexcept { return !m_Handle || m_Handle.done(); }
+
+            struct Awaiter
+            {
+                Handle Coroutine;
+
+                bool await_ready() const noexcept { return !Coroutine || Coroutine.done(); }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+                {
+                    Coroutine.promise().Continuation = awaiting;
+                    return Coroutine;
+                }
+
+                T await_resume() const
+                {
+                    LM_ASSERT_MSG(Coroutine, "Awaiting an empty Task");
+                    return Coroutine.promise().TakeResult();
+                }
+            };
+
+            // Start the task (if it hasn't finished) and continue with its result; rethrows its exception
+            Awaiter operator co_await() const noexcept { return Awaiter{ m_Handle }; }
+
+        private:
+            template<typename U>
+            friend U SyncWait(Task<U> task);
+
+            void Destroy() noexcept
+            {
+                if (m_Handle)
+                    m_Handle.destroy();
+                m_Handle = nullptr;
+            }
+
+            Handle m_Handle;
+        };
+
+        namespace Detail
+        {
+            template<typename T>
+            Task<T> TaskPromise<T>::get_return_object() noexcept
+            {
+                return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+            }
+
+            inline Task<void> TaskPromise<void>::get_return_object() noexcept
+            {
+                return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+            }
+
+            template<typename T>
+            DetachedTask RunDetached(Task<T> task)
+            {
+                co_await task;
+            }
+
+            // Runs the task to completion without touching its result, then signals counter
+            template<typename Handle>
+            DetachedTask RunAndSignal(Handle coroutine, JobCounter& counter)
+            {
+                struct Completion
+                {
+                    Handle Coroutine;
+                    bool await_ready() const noexcept { return Coroutine.done(); }
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+                    {
+                        Coroutine.promise().Continuation = awaiting;
+                        return Coroutine;
+                    }
+                    void await_resume() const noexcept {}
+                };
+
+                co_await Completion{ coroutine };
+                counter.Decrement();
+            }
+        }
+
+        // Start a task without waiting for it. The frame frees itself when the task finishes;
+        // an escaping exception is logged.
+        template<typename T>
+        void Spawn(Task<T> task)
+        {
+            Detail::RunDetached(std::move(task));
+        }
+
+        // Start a task and block until it finishes, executing other jobs meanwhile, then return its result.
+        // Must not be called on the main thread for a task that needs to resume on the main thread.
+        template<typename T>
+        T SyncWait(Task<T> task)
+        {
+            LM_ASSERT_MSG(task.IsValid(), "SyncWait on an empty Task");
+
+            JobCounter counter;
+            counter.Increment();
+            Detail::RunAndSignal(task.m_Handle, counter);
+            JobSystem::Get().Wait(counter);
+            return task.m_Handle.promise().TakeResult();
+        }
+
+        // Awaitables ------------------------------------------------------------------------------
+
+        // Continue on a worker thread (inline before JobSystem::Initialize)
+        struct ResumeOnWorkerAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                JobSystem::Get().Run([handle]() { handle.resume(); });
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        // Continue on the main thread during this frame's dispatcher drain; no-op when already there
+        struct ResumeOnMainThreadAwaiter
+        {
+            bool await_ready() const noexcept { return MainThreadDispatcher::Get().IsMainThread(); }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                MainThreadDispatcher::Get().Post([handle]() { handle.resume(); });
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        // Continue on the main thread at the start of the next frame
+        struct NextFrameAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                MainThreadDispatcher::Get().PostNextFrame([handle]() { handle.resume(); });
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        // Continue once a JobCounter reaches zero, on the worker pool. No thread blocks while waiting.
+        struct JobCounterAwaiter
+        {
+            JobCounter& Counter;
+            JobCounterWaiter Waiter;
+
+            bool await_ready() const noexcept { return Counter.IsDone(); }
+
+            bool await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                Waiter.Handle = handle;
+                return Counter.AddWaiter(&Waiter);
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        inline ResumeOnWorkerAwaiter ResumeOnWorker() noexcept { return {}; }
+        inline ResumeOnMainThreadAwaiter ResumeOnMainThread() noexcept { return {}; }
+        inline NextFrameAwaiter NextFrame() noexcept { return {}; }
+        inline JobCounterAwaiter WaitForCounter(JobCounter& counter) noexcept { return JobCounterAwaiter{ counter, {} }; }
+    }
+}
@@ -0,0 +1,225 @@
+#include "lmpch.h"
+#include "Core/Concurrency/TaskGraph.h"
+#include "Core/Log.h"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        TaskGraph::NodeId TaskGraph::AddNode(std::string name, JobFunction function, std::initializer_list<NodeId> dependencies)
+        {
+            const NodeId id = static_cast<NodeId>(m_Nodes.size());
+            for (NodeId dependency : dependencies)
+                LM_ASSERT_MSG(dependency < id, "TaskGraph node '{}' depends on unknown node {}", name, dependency);
+
+            Node& node = m_Nodes.emplace_back();
+            node.Name = std::move(name);
+            node.Function = std::move(function);
+            node.Dependencies.assign(dependencies.begin(), dependencies.end());
+            m_Compiled = false;
+            return id;
+        }
+
+        void TaskGraph::AddDependency(NodeId node, NodeId dependency)
+        {
+            LM_ASSERT_MSG(node < m_Nodes.size() && dependency < m_Nodes.size(), "TaskGraph dependency on unknown node");
+            m_Nodes[node].Dependencies.push_back(dependency);
+            m_Compiled = false;
+        }
+
+        void TaskGraph::Clear()
+        {
+            m_Nodes.clear();
+            m_Order.clear();
+            m_Roots.clear();
+            m_Remaining.reset();
+            m_Compiled = false;
+        }
+
+        void TaskGraph::Compile()
+        {
+            const size_t count = m_Nodes.size();
+            std::vector<uint32_t> inDegree(count, 0);
+            for (auto& node : m_Nodes)
+                node.Successors.clear();
+            for (NodeId id = 0; id < count; ++id)
+            {
+                for (NodeId dependency : m_Nodes[id].Dependencies)
+                    m_Nodes[dependency].Successors.push_back(id);
+                inDegree[id] = static_cast<uint32_t>(m_Nodes[id].Dependencies.size());
+            }
+
+            // Kahn's algorithm; anything left unvisited sits on a cycle
+            m_Order.clear();
+            m_Roots.clear();
+            for (NodeId id = 0; id < count; ++id)
+            {
+                if (inDegree[id] == 0)
+                {
+                    m_Order.push_back(id);
+                    m_Roots.push_back(id);
+                }
+            }
+            for (size_t i = 0; i < m_Order.size(); ++i)
+            {
+                for (NodeId successor : m_Nodes[m_Order[i]].Successors)
+                {
+                    if (--inDegree[successor] == 0)
+                        m_Order.push_back(successor);
+                }
+            }
+
+            if (m_Order.size() != count)
+            {
+                for (NodeId id = 0; id < count; ++id)
+                {
+                    if (inDegree[id] != 0)
+                    {
+                        LM_LOG_CAT_ERROR(Concurrency, "TaskGraph has a dependency cycle through node '{}'", m_Nodes[id].Name);
+                        break;
+                    }
+                }
+                throw std::runtime_error("TaskGraph has a dependency cycle");
+            }
+
+            m_Remaining = std::make_unique<std::atomic<uint32_t>[]>(count);
+            m_Ready.clear();
+            m_Ready.reserve(count);
+            UpdatePriorities();
+            m_Compiled = true;
+        }
+
+        void TaskGraph::UpdatePriorities()
+        {
+            // Longest path to a sink, walking the topological order backwards
+            for (auto it = m_Order.rbegin(); it != m_Order.rend(); ++it)
+            {
+                Node& node = m_Nodes[*it];
+                uint64_t longestSuccessor = 0;
+                for (NodeId successor : node.Successors)
+                    longestSuccessor = std::max(longestSuccessor, m_Nodes[successor].Priority);
+
+                const uint64_t cost = static_cast<uint64_t>(node.Timing.Duration.count());
+                node.Priority = std::max<uint64_t>(cost, 1) + longestSuccessor;
+            }
+        }
+
+        void TaskGraph::Execute()
+        {
+            if (m_Nodes.empty())
+                return;
+            if (!m_Compiled)
+                Compile();
+
+            for (NodeId id = 0; id < m_Nodes.size(); ++id)
+                m_Remaining[id].store(static_cast<uint32_t>(m_Nodes[id].Dependencies.size()), std::memory_order_relaxed);
+
+            m_FrameStart = std::chrono::steady_clock::now();
+            for (NodeId root : m_Roots)
+                MakeReady(root);
+            JobSystem::Get().Wait(m_Counter);
+
+            m_LastDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_FrameStart);
+            UpdatePriorities();
+        }
+
+        void TaskGraph::MakeReady(NodeId node)
+        {
+            {
+                std::scoped_lock lock(m_ReadyMutex);
+                m_Ready.push_back(node);
+                std::push_heap(m_Ready.begin(), m_Ready.end(), [this](NodeId a, NodeId b) { return m_Nodes[a].Priority < m_Nodes[b].Priority; });
+            }
+
+            // One job per ready node, but the job runs whichever ready node is most critical when it starts
+            JobSystem::Get().Run([this]() { RunNext(); }, &m_Counter);
+        }
+
+        void TaskGraph::RunNext()
+        {
+            NodeId id;
+            {
+                std::scoped_lock lock(m_ReadyMutex);
+                std::pop_heap(m_Ready.begin(), m_Ready.end(), [this](NodeId a, NodeId b) { return m_Nodes[a].Priority < m_Nodes[b].Priority; });
+                id = m_Ready.back();
+                m_Ready.pop_back();
+            }
+
+            Node& node = m_Nodes[id];
+            const auto start = std::chrono::steady_clock::now();
+            if (node.Function)
+                node.Function();
+            const auto end = std::chrono::steady_clock::now();
+
+            node.Timing.Start = std::chrono::duration_cast<std::chrono::microseconds>(start - m_FrameStart);
+            node.Timing.Duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            node.Timing.Worker = JobSystem::GetCurrentWorkerIndex();
+
+            for (NodeId successor : node.Successors)
+            {
+                if (m_Remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    MakeReady(successor);
+            }
+        }
+
+        nlohmann::json TaskGraph::ExportTrace() const
+        {
+            nlohmann::json events = nlohmann::json::array();
+            int maxWorker = -1;
+
+            for (NodeId id = 0; id < m_Nodes.size(); ++id)
+            {
+                const Node& node = m_Nodes[id];
+                maxWorker = std::max(maxWorker, node.Timing.Worker);
+
+                std::vector<std::string> dependencies;
+                for (NodeId dependency : node.Dependencies)
+                    dependencies.push_back(m_Nodes[dependency].Name);
+
+                events.push_back({
+                    { "name", node.Name },
+                    { "cat", "TaskGraph" },
+                    { "ph", "X" },
+                    { "pid", 0 },
+                    { "tid", node.Timing.Worker + 1 },
+                    { "ts", node.Timing.Start.count() },
+                    { "dur", node.Timing.Duration.count() },
+                    { "args", { { "id", id }, { "priority", node.Priority }, { "dependencies", dependencies } } }
+                });
+            }
+
+            // Track names: tid 0 is the thread that called Execute
+            for (int tid = 0; tid <= maxWorker + 1; ++tid)
+            {
+                events.push_back({
+                    { "name", "thread_name" },
+                    { "ph", "M" },
+                    { "pid", 0 },
+                    { "tid", tid },
+                    { "args", { { "name", tid == 0 ? std::string("Caller") : "Worker " + std::to_string(tid - 1) } } }
+                });
+            }
+
+            return {
+                { "traceEvents", std::move(events) },
+                { "displayTimeUnit", "ms" }
+            };
+        }
+
+        void TaskGraph::SaveTrace(const std::filesystem::path& path) const
+        {
+            std::ofstream file(path);
+            if (!file)
+            {
+                LM_LOG_CAT_ERROR(Concurrency, "Failed to open '{}' for the task graph trace", path.string());
+                return;
+            }
+            file << ExportTrace().dump(2);
+        }
+    }
+}
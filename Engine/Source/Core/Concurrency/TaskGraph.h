@@ -0,0 +1,105 @@
+#pragma once
+
+#include "lmpch.h"
+#include "Core/Concurrency/JobSystem.h"
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Per-frame graph of jobs with explicit dependencies.
+        // Nodes are registered once; Compile validates the graph and caches its topological order and
+        // successor lists, and Execute re-dispatches it every frame onto the JobSystem. Whenever a worker is
+        // free it takes the ready node with the longest remaining path to the end of the graph, weighted by
+        // the durations measured on the previous run, so the critical path starts as early as possible.
+        //
+        //     auto animation = graph.AddNode("Animation", UpdateAnimation);
+        //     auto culling   = graph.AddNode("Culling", UpdateCulling);
+        //     graph.AddNode("Skinning", UpdateSkinning, { animation, culling });
+        class TaskGraph
+        {
+        public:
+            using NodeId = uint32_t;
+            static constexpr NodeId InvalidNode = ~0u;
+
+            struct NodeTiming
+            {
+                std::chrono::microseconds Start{ 0 };     // Relative to the start of Execute
+                std::chrono::microseconds Duration{ 0 };
+                int Worker = -1;                          // JobSystem worker index, -1 for the executing thread
+            };
+
+            TaskGraph() = default;
+            TaskGraph(const TaskGraph&) = delete;
+            TaskGraph& operator=(const TaskGraph&) = delete;
+
+            // Register a node that runs after every node in dependencies. Invalidates the compiled graph.
+            NodeId AddNode(std::string name, JobFunction function, std::initializer_list<NodeId> dependencies = {});
+
+            // Add an edge after the fact: node runs after dependency
+            void AddDependency(NodeId node, NodeId dependency);
+
+            // Remove every node
+            void Clear();
+
+            // Validate and cache the execution order. Throws std::runtime_error if the graph has a cycle.
+            // Execute compiles on demand, so calling this is only needed to surface errors early.
+            void Compile();
+
+            // Run every node once and block until all have finished. The calling thread executes jobs meanwhile.
+            void Execute();
+
+            bool IsCompiled() const noexcept { return m_Compiled; }
+            bool IsEmpty() const noexcept { return m_Nodes.empty(); }
+            size_t GetNodeCount() const noexcept { return m_Nodes.size(); }
+
+            const NodeTiming& GetTiming(NodeId node) const { return m_Nodes[node].Timing; }
+            std::chrono::microseconds GetLastDuration() const noexcept { return m_LastDuration; }
+
+            // Graph and timings of the last Execute in Chrome trace format (chrome://tracing, Perfetto).
+            // Each node is a complete event on its worker's track; dependencies and priority are in its args.
+            nlohmann::json ExportTrace() const;
+            void SaveTrace(const std::filesystem::path& path) const;
+
+        private:
+            struct Node
+            {
+                std::string Name;
+                JobFunction Function;
+                std::vector<NodeId> Dependencies;
+                std::vector<NodeId> Successors;  // Built by Compile
+                uint64_t Priority = 0;           // Longest path to a sink, in microseconds (nodes count at least 1)
+                NodeTiming Timing;
+            };
+
+            void UpdatePriorities();
+            void MakeReady(NodeId node);
+            void RunNext();
+
+        private:
+            std::vector<Node> m_Nodes;
+            std::vector<NodeId> m_Order;         // Topological order
+            std::vector<NodeId> m_Roots;
+            bool m_Compiled = false;
+
+            // Per-execution state
+            std::unique_ptr<std::atomic<uint32_t>[]> m_Remaining;
+            std::mutex m_ReadyMutex;
+            std::vector<NodeId> m_Ready;         // Max-heap on priority
+            JobCounter m_Counter;
+            std::chrono::steady_clock::time_point m_FrameStart;
+            std::chrono::microseconds m_LastDuration{ 0 };
+        };
+    }
+}
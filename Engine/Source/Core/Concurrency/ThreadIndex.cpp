@@ -0,0 +1,61 @@
+#include "lmpch.h"
+#include "Core/Concurrency/ThreadIndex.h"
+
+#include <mutex>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        namespace
+        {
+            class IndexAllocator
+            {
+            public:
+                uint32_t Acquire() noexcept
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    if (!m_Free.empty())
+                    {
+                        uint32_t index = m_Free.back();
+                        m_Free.pop_back();
+                        return index;
+                    }
+                    return m_Next < ThreadIndex::MaxThreads ? m_Next++ : ThreadIndex::InvalidIndex;
+                }
+
+                void Release(uint32_t index) noexcept
+                {
+                    if (index == ThreadIndex::InvalidIndex)
+                        return;
+                    std::scoped_lock lock(m_Mutex);
+                    m_Free.push_back(index);
+                }
+
+            private:
+                std::mutex m_Mutex;
+                std::vector<uint32_t> m_Free;
+                uint32_t m_Next = 0;
+            };
+
+            IndexAllocator& GetAllocator()
+            {
+                // Leaked on purpose: thread_local destructors may run after static destruction
+                static IndexAllocator* allocator = new IndexAllocator();
+                return *allocator;
+            }
+
+            struct ThreadSlot
+            {
+                uint32_t Index = GetAllocator().Acquire();
+                ~ThreadSlot() { GetAllocator().Release(Index); }
+            };
+        }
+
+        uint32_t ThreadIndex::Get() noexcept
+        {
+            static thread_local ThreadSlot slot;
+            return slot.Index;
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Limitless
+{
+    namespace Concurrency
+    {
+        // Small dense per-thread index, assigned on first use and recycled when the thread exits.
+        // Lets concurrent structures keep per-thread state in a flat array instead of a map.
+        class ThreadIndex
+        {
+        public:
+            // Upper bound on simultaneously indexed threads. Threads beyond it get InvalidIndex.
+            static constexpr uint32_t MaxThreads = 128;
+            static constexpr uint32_t InvalidIndex = ~0u;
+
+            // Index of the calling thread in [0, MaxThreads), or InvalidIndex if all are taken
+            static uint32_t Get() noexcept;
+        };
+    }
+}
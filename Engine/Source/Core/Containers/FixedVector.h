@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Containers
+    {
+        // Vector with a hard capacity of N elements stored inline. It never allocates, so it suits hot
+        // per-frame lists with a known bound and objects that must not touch the heap. Exceeding N is a bug:
+        // EmplaceBack asserts, while TryEmplaceBack reports it by returning nullptr.
+        template<typename T, size_t N>
+        class FixedVector
+        {
+            static_assert(N > 0, "FixedVector needs a capacity");
+
+        public:
+            using value_type = T;
+            using size_type = size_t;
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            FixedVector() noexcept = default;
+
+            FixedVector(std::initializer_list<T> values)
+            {
+                LM_ASSERT_MSG(values.size() <= N, "FixedVector initializer has {} elements, capacity is {}", values.size(), N);
+                std::uninitialized_copy(values.begin(), values.end(), Data());
+                m_Size = values.size();
+            }
+
+            FixedVector(const FixedVector& other)
+            {
+                std::uninitialized_copy(other.begin(), other.end(), Data());
+                m_Size = other.m_Size;
+            }
+
+            FixedVector(FixedVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+                std::uninitialized_move(other.begin(), other.end(), Data());
+                m_Size = other.m_Size;
+                other.Clear();
+            }
+
+            FixedVector& operator=(const FixedVector& other)
+            {
+                if (this != &other)
+                {
+                    Clear();
+                    std::uninitialized_copy(other.begin(), other.end(), Data());
+                    m_Size = other.m_Size;
+                }
+                return *this;
+            }
+
+            FixedVector& operator=(FixedVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+                if (this != &other)
+                {
+                    Clear();
+                    std::uninitialized_move(other.begin(), other.end(), Data());
+                    m_Size = other.m_Size;
+                    other.Clear();
+                }
+                return *this;
+            }
+
+            ~FixedVector() { Clear(); }
+
+            template<typename... Args>
+            T& EmplaceBack(Args&&... args)
+            {
+                LM_ASSERT_MSG(m_Size < N, "FixedVector capacity of {} exceeded", N);
+                T* element = new (Data() + m_Size) T(std::forward<Args>(args)...);
+                ++m_Size;
+                return *element;
+            }
+
+            // nullptr when full
+            template<typename... Args>
+            T* TryEmplaceBack(Args&&... args)
+            {
+                if (m_Size == N)
+                    return nullptr;
+                return &EmplaceBack(std::forward<Args>(args)...);
+            }
+
+            void PushBack(const T& value) { EmplaceBack(value); }
+            void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+            void PopBack() noexcept
+            {
+                LM_ASSERT_MSG(m_Size > 0, "PopBack on an empty FixedVector");
+                std::destroy_at(Data() + --m_Size);
+            }
+
+            // Removes the element at position, shifting the rest down; returns the following position
+            iterator Erase(const_iterator position)
+            {
+                T* target = Data() + (position - Data());
+                std::move(target + 1, end(), target);
+                PopBack();
+                return target;
+            }
+
+            // O(1) removal that moves the last element into the hole
+            void SwapErase(size_t index)
+            {
+                LM_ASSERT_MSG(index < m_Size, "FixedVector index {} out of range ({})", index, m_Size);
+                if (index != m_Size - 1)
+                    Data()[index] = std::move(Data()[m_Size - 1]);
+                PopBack();
+            }
+
+            // New elements are value-initialized
+            void Resize(size_t size)
+            {
+                LM_ASSERT_MSG(size <= N, "FixedVector resized to {}, capacity is {}", size, N);
+                if (size > m_Size)
+                    std::uninitialized_value_construct(Data() + m_Size, Data() + size);
+                else
+                    std::destroy(Data() + size, Data() + m_Size);
+                m_Size = size;
+            }
+
+            void Clear() noexcept
+            {
+                std::destroy(Data(), Data() + m_Size);
+                m_Size = 0;
+            }
+
+            T& operator[](size_t index) noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "FixedVector index {} out of range ({})", index, m_Size);
+                return Data()[index];
+            }
+
+            const T& operator[](size_t index) const noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "FixedVector index {} out of range ({})", index, m_Size);
+                return Data()[index];
+            }
+
+            T& Front() noexcept { return Data()[0]; }
+            const T& Front() const noexcept { return Data()[0]; }
+            T& Back() noexcept { return Data()[m_Size - 1]; }
+            const T& Back() const noexcept { return Data()[m_Size - 1]; }
+
+            T* Data() noexcept { return reinterpret_cast<T*>(m_Storage); }
+            const T* Data() const noexcept { return reinterpret_cast<const T*>(m_Storage); }
+            iterator begin() noexcept { return Data(); }
+            iterator end() noexcept { return Data() + m_Size; }
+            const_iterator begin() const noexcept { return Data(); }
+            const_iterator end() const noexcept { return Data() + m_Size; }
+
+            size_t Size() const noexcept { return m_Size; }
+            bool Empty() const noexcept { return m_Size == 0; }
+            bool Full() const noexcept { return m_Size == N; }
+            static constexpr size_t Capacity() noexcept { return N; }
+
+        private:
+            alignas(T) std::byte m_Storage[N * sizeof(T)];
+            size_t m_Size = 0;
+        };
+    }
+}
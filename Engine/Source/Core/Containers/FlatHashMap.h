@@ -0,0 +1,524 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define LM_FLATHASHMAP_SSE2 1
+#endif
+
+namespace Limitless
+{
+    namespace Containers
+    {
+        namespace Detail
+        {
+            // One control byte per slot: the top bit set means empty or deleted, otherwise the low 7 bits
+            // hold H2, seven bits of the key's hash used to filter candidates before comparing keys
+            enum class Control : int8_t
+            {
+                Empty = -128,   // 0b10000000
+                Deleted = -2    // 0b11111110
+            };
+
+            // Sixteen control bytes examined at once; each match is a bit in the returned mask
+            struct Group
+            {
+                static constexpr size_t Width = 16;
+
+#if defined(LM_FLATHASHMAP_SSE2)
+                explicit Group(const int8_t* control) noexcept
+                    : m_Bytes(_mm_load_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+                uint32_t Match(int8_t h2) const noexcept
+                {
+                    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Bytes)));
+                }
+
+                uint32_t MatchEmpty() const noexcept
+                {
+                    return Match(static_cast<int8_t>(Control::Empty));
+                }
+
+                uint32_t MatchEmptyOrDeleted() const noexcept
+                {
+                    return static_cast<uint32_t>(_mm_movemask_epi8(m_Bytes));
+                }
+
+                __m128i m_Bytes;
+#else
+                // Portable fallback; compilers turn these loops into NEON/SIMD compares where available
+                explicit Group(const int8_t* control) noexcept { std::memcpy(m_Bytes, control, Width); }
+
+                uint32_t Match(int8_t h2) const noexcept
+                {
+                    uint32_t mask = 0;
+                    for (uint32_t i = 0; i < Width; ++i)
+                        mask |= static_cast<uint32_t>(m_Bytes[i] == h2) << i;
+                    return mask;
+                }
+
+                uint32_t MatchEmpty() const noexcept
+                {
+                    return Match(static_cast<int8_t>(Control::Empty));
+                }
+
+                uint32_t MatchEmptyOrDeleted() const noexcept
+                {
+                    uint32_t mask = 0;
+                    for (uint32_t i = 0; i < Width; ++i)
+                        mask |= static_cast<uint32_t>(m_Bytes[i] < 0) << i;
+                    return mask;
+                }
+
+                int8_t m_Bytes[Width];
+#endif
+            };
+
+            // std::hash is the identity for integers; spread the bits so H1 and H2 are independent
+            inline uint64_t MixHash(uint64_t hash) noexcept
+            {
+                hash ^= hash >> 33;
+                hash *= 0xff51afd7ed558ccdull;
+                hash ^= hash >> 33;
+                return hash;
+            }
+        }
+
+        // Open-addressing hash map in the style of Abseil's SwissTable.
+        // Keys and values live inline in one flat slot array next to a byte-per-slot control array. A lookup
+        // hashes once, then checks sixteen control bytes per step with SSE2 and only compares keys whose 7-bit
+        // hash fragment matches, so a hit usually touches one control group and one slot. Groups are aligned
+        // and probed quadratically; the table grows at 7/8 load. Memory comes from a std::pmr::memory_resource.
+        //
+        // Unlike std::unordered_map, inserting or erasing invalidates iterators and references. value_type is
+        // std::pair<K, V>, so keys are reachable through iterators: never modify them.
+        template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+        class FlatHashMap
+        {
+        public:
+            using key_type = K;
+            using mapped_type = V;
+            using value_type = std::pair<K, V>;
+            using size_type = size_t;
+
+            template<bool Const>
+            class Iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = FlatHashMap::value_type;
+                using difference_type = std::ptrdiff_t;
+                using reference = std::conditional_t<Const, const value_type&, value_type&>;
+                using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+                Iterator() = default;
+                Iterator(const int8_t* control, const int8_t* end, pointer slot) noexcept
+                    : m_Control(control), m_End(end), m_Slot(slot) { SkipEmpty(); }
+
+                // iterator converts to const_iterator
+                template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+                Iterator(const Iterator<OtherConst>& other) noexcept
+                    : m_Control(other.m_Control), m_End(other.m_End), m_Slot(other.m_Slot) {}
+
+                reference operator*() const noexcept { return *m_Slot; }
+                pointer operator->() const noexcept { return m_Slot; }
+
+                Iterator& operator++() noexcept
+                {
+                    ++m_Control;
+                    ++m_Slot;
+                    SkipEmpty();
+                    return *this;
+                }
+
+                Iterator operator++(int) noexcept
+                {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.m_Control == b.m_Control; }
+
+            private:
+                template<bool> friend class Iterator;
+                friend class FlatHashMap;
+
+                void SkipEmpty() noexcept
+                {
+                    while (m_Control != m_End && *m_Control < 0)
+                    {
+                        ++m_Control;
+                        ++m_Slot;
+                    }
+                }
+
+                const int8_t* m_Control = nullptr;
+                const int8_t* m_End = nullptr;
+                pointer m_Slot = nullptr;
+            };
+
+            using iterator = Iterator<false>;
+            using const_iterator = Iterator<true>;
+
+            explicit FlatHashMap(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept
+                : m_Resource(resource) {}
+
+            FlatHashMap(std::initializer_list<value_type> values,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : m_Resource(resource)
+            {
+                Reserve(values.size());
+                for (const value_type& value : values)
+                    TryEmplace(value.first, value.second);
+            }
+
+            // Copies allocate from the source's resource
+            FlatHashMap(const FlatHashMap& other) : m_Resource(other.m_Resource), m_Hash(other.m_Hash), m_Equal(other.m_Equal)
+            {
+                Reserve(other.m_Size);
+                for (const value_type& value : other)
+                    InsertUnique(value.first, value.second);
+            }
+
+            FlatHashMap(FlatHashMap&& other) noexcept
+                : m_Resource(other.m_Resource), m_Hash(std::move(other.m_Hash)), m_Equal(std::move(other.m_Equal))
+            {
+                StealFrom(other);
+            }
+
+            FlatHashMap& operator=(const FlatHashMap& other)
+            {
+                if (this != &other)
+                {
+                    FlatHashMap copy(other);
+                    *this = std::move(copy);
+                }
+                return *this;
+            }
+
+            FlatHashMap& operator=(FlatHashMap&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    DestroyAndFree();
+                    m_Resource = other.m_Resource;
+                    m_Hash = std::move(other.m_Hash);
+                    m_Equal = std::move(other.m_Equal);
+                    StealFrom(other);
+                }
+                return *this;
+            }
+
+            ~FlatHashMap() { DestroyAndFree(); }
+
+            // Inserts V(args...) unless key is present; returns the element and whether it was inserted
+            template<typename... Args>
+            std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args)
+            {
+                const uint64_t hash = HashOf(key);
+                if (size_t index = FindIndex(key, hash); index != NotFound)
+                    return { MakeIterator(index), false };
+                return { MakeIterator(InsertNew(hash, key, std::forward<Args>(args)...)), true };
+            }
+
+            template<typename... Args>
+            std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args)
+            {
+                const uint64_t hash = HashOf(key);
+                if (size_t index = FindIndex(key, hash); index != NotFound)
+                    return { MakeIterator(index), false };
+                return { MakeIterator(InsertNew(hash, std::move(key), std::forward<Args>(args)...)), true };
+            }
+
+            // Inserts or overwrites
+            template<typename M>
+            std::pair<iterator, bool> InsertOrAssign(const K& key, M&& value)
+            {
+                auto result = TryEmplace(key, std::forward<M>(value));
+                if (!result.second)
+                    result.first->second = std::forward<M>(value);
+                return result;
+            }
+
+            V& operator[](const K& key) { return TryEmplace(key).first->second; }
+            V& operator[](K&& key) { return TryEmplace(std::move(key)).first->second; }
+
+            iterator Find(const K& key) noexcept
+            {
+                size_t index = FindIndex(key, HashOf(key));
+                return index != NotFound ? MakeIterator(index) : end();
+            }
+
+            const_iterator Find(const K& key) const noexcept
+            {
+                size_t index = FindIndex(key, HashOf(key));
+                return index != NotFound ? MakeIterator(index) : end();
+            }
+
+            // nullptr when absent
+            V* TryGet(const K& key) noexcept
+            {
+                size_t index = FindIndex(key, HashOf(key));
+                return index != NotFound ? &m_Slots[index].second : nullptr;
+            }
+
+            const V* TryGet(const K& key) const noexcept
+            {
+                size_t index = FindIndex(key, HashOf(key));
+                return index != NotFound ? &m_Slots[index].second : nullptr;
+            }
+
+            bool Contains(const K& key) const noexcept { return FindIndex(key, HashOf(key)) != NotFound; }
+
+            bool Erase(const K& key)
+            {
+                size_t index = FindIndex(key, HashOf(key));
+                if (index == NotFound)
+                    return false;
+                EraseAt(index);
+                return true;
+            }
+
+            // Returns the iterator following the erased element
+            iterator Erase(const_iterator position)
+            {
+                size_t index = static_cast<size_t>(position.m_Control - m_Control);
+                EraseAt(index);
+                return iterator(m_Control + index, m_Control + m_Capacity, m_Slots + index);
+            }
+
+            void Clear() noexcept
+            {
+                if (m_Capacity == 0)
+                    return;
+                DestroySlots();
+                std::memset(m_Control, static_cast<int8_t>(Detail::Control::Empty), m_Capacity);
+                m_Size = 0;
+                m_GrowthLeft = MaxLoad(m_Capacity);
+            }
+
+            // Size the table so count elements fit without rehashing
+            void Reserve(size_t count)
+            {
+                size_t capacity = Detail::Group::Width;
+                while (MaxLoad(capacity) < count)
+                    capacity *= 2;
+                if (capacity > m_Capacity)
+                    Rehash(capacity);
+            }
+
+            size_t Size() const noexcept { return m_Size; }
+            bool Empty() const noexcept { return m_Size == 0; }
+            size_t Capacity() const noexcept { return m_Capacity; }
+            float LoadFactor() const noexcept { return m_Capacity ? static_cast<float>(m_Size) / static_cast<float>(m_Capacity) : 0.0f; }
+            std::pmr::memory_resource* GetResource() const noexcept { return m_Resource; }
+
+            iterator begin() noexcept { return iterator(m_Control, m_Control + m_Capacity, m_Slots); }
+            iterator end() noexcept { return iterator(m_Control + m_Capacity, m_Control + m_Capacity, m_Slots + m_Capacity); }
+            const_iterator begin() const noexcept { return const_iterator(m_Control, m_Control + m_Capacity, m_Slots); }
+            const_iterator end() const noexcept { return const_iterator(m_Control + m_Capacity, m_Control + m_Capacity, m_Slots + m_Capacity); }
+
+        private:
+            static constexpr size_t NotFound = ~size_t(0);
+
+            static constexpr size_t MaxLoad(size_t capacity) noexcept { return capacity - capacity / 8; }
+
+            uint64_t HashOf(const K& key) const noexcept { return Detail::MixHash(static_cast<uint64_t>(m_Hash(key))); }
+            static int8_t H2(uint64_t hash) noexcept { return static_cast<int8_t>(hash & 0x7F); }
+            size_t GroupMask() const noexcept { return m_Capacity / Detail::Group::Width - 1; }
+
+            iterator MakeIterator(size_t index) noexcept { return iterator(m_Control + index, m_Control + m_Capacity, m_Slots + index); }
+            const_iterator MakeIterator(size_t index) const noexcept { return const_iterator(m_Control + index, m_Control + m_Capacity, m_Slots + index); }
+
+            // Visits groups in a triangular sequence, which covers every group of a power-of-two table
+            template<typename Fn>
+            size_t Probe(uint64_t hash, Fn&& visit) const noexcept
+            {
+                const size_t mask = GroupMask();
+                size_t group = static_cast<size_t>(hash >> 7) & mask;
+                for (size_t step = 1;; ++step)
+                {
+                    size_t found = visit(group * Detail::Group::Width);
+                    if (found != NotFound)
+                        return found;
+                    group = (group + step) & mask;
+                }
+            }
+
+            size_t FindIndex(const K& key, uint64_t hash) const noexcept
+            {
+                if (m_Size == 0)
+                    return NotFound;
+
+                const int8_t h2 = H2(hash);
+                size_t result = NotFound;
+                Probe(hash, [&](size_t base) -> size_t
+                {
+                    Detail::Group group(m_Control + base);
+                    for (uint32_t matches = group.Match(h2); matches != 0; matches &= matches - 1)
+                    {
+                        size_t index = base + static_cast<size_t>(std::countr_zero(matches));
+                        if (m_Equal(m_Slots[index].first, key))
+                        {
+                            result = index;
+                            return index;
+                        }
+                    }
+                    // An empty slot ends the chain: the key would have been placed here
+                    return group.MatchEmpty() != 0 ? base : NotFound;
+                });
+                return result;
+            }
+
+            size_t FindInsertSlot(uint64_t hash) const noexcept
+            {
+                return Probe(hash, [&](size_t base) -> size_t
+                {
+                    uint32_t free = Detail::Group(m_Control + base).MatchEmptyOrDeleted();
+                    return free != 0 ? base + static_cast<size_t>(std::countr_zero(free)) : NotFound;
+                });
+            }
+
+            template<typename KeyArg, typename... Args>
+            size_t InsertNew(uint64_t hash, KeyArg&& key, Args&&... args)
+            {
+                if (m_GrowthLeft == 0)
+                {
+                    // Mostly tombstones: rehash in place; otherwise double
+                    Rehash(m_Capacity == 0 ? Detail::Group::Width : (m_Size * 2 < MaxLoad(m_Capacity) ? m_Capacity : m_Capacity * 2));
+                }
+
+                size_t index = FindInsertSlot(hash);
+                new (m_Slots + index) value_type(std::piecewise_construct,
+                                                 std::forward_as_tuple(std::forward<KeyArg>(key)),
+                                                 std::forward_as_tuple(std::forward<Args>(args)...));
+                if (m_Control[index] == static_cast<int8_t>(Detail::Control::Empty))
+                    --m_GrowthLeft;
+                m_Control[index] = H2(hash);
+                ++m_Size;
+                return index;
+            }
+
+            // For rehash and copy: the key is known to be absent and there is room
+            template<typename KeyArg, typename ValueArg>
+            void InsertUnique(KeyArg&& key, ValueArg&& value)
+            {
+                const uint64_t hash = HashOf(key);
+                size_t index = FindInsertSlot(hash);
+                new (m_Slots + index) value_type(std::forward<KeyArg>(key), std::forward<ValueArg>(value));
+                m_Control[index] = H2(hash);
+                --m_GrowthLeft;
+                ++m_Size;
+            }
+
+            void EraseAt(size_t index)
+            {
+                std::destroy_at(m_Slots + index);
+                --m_Size;
+
+                // A group that still has an empty slot has never been full, so no probe chain passes through
+                // it and the slot can become empty again; otherwise leave a tombstone
+                const size_t base = index & ~(Detail::Group::Width - 1);
+                if (Detail::Group(m_Control + base).MatchEmpty() != 0)
+                {
+                    m_Control[index] = static_cast<int8_t>(Detail::Control::Empty);
+                    ++m_GrowthLeft;
+                }
+                else
+                {
+                    m_Control[index] = static_cast<int8_t>(Detail::Control::Deleted);
+                }
+            }
+
+            static size_t SlotOffset(size_t capacity) noexcept
+            {
+                return (capacity + alignof(value_type) - 1) / alignof(value_type) * alignof(value_type);
+            }
+
+            static size_t AllocationSize(size_t capacity) noexcept { return SlotOffset(capacity) + capacity * sizeof(value_type); }
+            static size_t AllocationAlignment() noexcept { return std::max<size_t>(alignof(value_type), Detail::Group::Width); }
+
+            void Rehash(size_t capacity)
+            {
+                int8_t* oldControl = m_Control;
+                value_type* oldSlots = m_Slots;
+                const size_t oldCapacity = m_Capacity;
+
+                auto* memory = static_cast<std::byte*>(m_Resource->allocate(AllocationSize(capacity), AllocationAlignment()));
+                m_Control = reinterpret_cast<int8_t*>(memory);
+                m_Slots = reinterpret_cast<value_type*>(memory + SlotOffset(capacity));
+                m_Capacity = capacity;
+                m_GrowthLeft = MaxLoad(capacity);
+                m_Size = 0;
+                std::memset(m_Control, static_cast<int8_t>(Detail::Control::Empty), capacity);
+
+                for (size_t i = 0; i < oldCapacity; ++i)
+                {
+                    if (oldControl[i] >= 0)
+                    {
+                        InsertUnique(std::move(oldSlots[i].first), std::move(oldSlots[i].second));
+                        std::destroy_at(oldSlots + i);
+                    }
+                }
+
+                if (oldCapacity > 0)
+                    m_Resource->deallocate(oldControl, AllocationSize(oldCapacity), AllocationAlignment());
+            }
+
+            void DestroySlots() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<value_type>)
+                {
+                    for (size_t i = 0; i < m_Capacity; ++i)
+                    {
+                        if (m_Control[i] >= 0)
+                            std::destroy_at(m_Slots + i);
+                    }
+                }
+            }
+
+            void DestroyAndFree() noexcept
+            {
+                if (m_Capacity == 0)
+                    return;
+                DestroySlots();
+                m_Resource->deallocate(m_Control, AllocationSize(m_Capacity), AllocationAlignment());
+                m_Control = nullptr;
+                m_Slots = nullptr;
+                m_Capacity = m_Size = m_GrowthLeft = 0;
+            }
+
+            void StealFrom(FlatHashMap& other) noexcept
+            {
+                m_Control = std::exchange(other.m_Control, nullptr);
+                m_Slots = std::exchange(other.m_Slots, nullptr);
+                m_Capacity = std::exchange(other.m_Capacity, 0);
+                m_Size = std::exchange(other.m_Size, 0);
+                m_GrowthLeft = std::exchange(other.m_GrowthLeft, 0);
+            }
+
+            int8_t* m_Control = nullptr;
+            value_type* m_Slots = nullptr;
+            size_t m_Capacity = 0;      // Power of two, at least one group, or 0 before the first insert
+            size_t m_Size = 0;
+            size_t m_GrowthLeft = 0;    // Empty slots that may still be filled before the table must grow
+            std::pmr::memory_resource* m_Resource;
+            [[no_unique_address]] Hash m_Hash;
+            [[no_unique_address]] KeyEqual m_Equal;
+        };
+    }
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Containers
+    {
+        // Reference to an object in a HandlePool<T>. The generation is bumped every time a slot is freed,
+        // so a handle to a destroyed object stays detectably stale after its slot is reused.
+        // A default-constructed handle is null and never valid.
+        template<typename T>
+        struct Handle
+        {
+            uint32_t Index = 0;
+            uint32_t Generation = 0;
+
+            bool IsNull() const noexcept { return Generation == 0; }
+            explicit operator bool() const noexcept { return !IsNull(); }
+
+            bool operator==(const Handle&) const noexcept = default;
+        };
+
+        // Densely packed storage addressed through generational handles.
+        // Values live contiguously in a vector, so iteration touches nothing but live objects. A sparse slot
+        // table maps a handle's index to the value's current position; destroying swaps the last value into
+        // the hole, and freed slots are recycled through an intrusive free list. Create, Destroy and Get are
+        // all O(1), with no reference counting. Not thread-safe: guard it externally or keep it on one thread.
+        //
+        // Pointers and references returned by Get are invalidated by Create and Destroy; hold handles instead.
+        template<typename T>
+        class HandlePool
+        {
+        public:
+            using HandleType = Handle<T>;
+
+            HandlePool() = default;
+            explicit HandlePool(size_t capacity) { Reserve(capacity); }
+
+            template<typename... Args>
+            HandleType Create(Args&&... args)
+            {
+                // Grow the bookkeeping before constructing: once the value is in place nothing below can throw,
+                // so a throwing constructor or allocation leaves the pool untouched
+                uint32_t index = m_FreeHead;
+                if (index == NullIndex)
+                {
+                    LM_ASSERT_MSG(m_Slots.size() < NullIndex, "HandlePool exhausted its 32-bit index space");
+                    GrowForOneMore(m_Slots);
+                }
+                GrowForOneMore(m_DenseToSlot);
+                m_Values.emplace_back(std::forward<Args>(args)...);
+
+                if (index != NullIndex)
+                {
+                    m_FreeHead = m_Slots[index].NextFree;
+                }
+                else
+                {
+                    index = static_cast<uint32_t>(m_Slots.size());
+                    m_Slots.emplace_back();
+                }
+                m_DenseToSlot.push_back(index);
+
+                Slot& slot = m_Slots[index];
+                slot.Dense = static_cast<uint32_t>(m_Values.size() - 1);
+                slot.NextFree = NullIndex;
+                return { index, slot.Generation };
+            }
+
+            // Returns false (and does nothing) for stale or null handles
+            bool Destroy(HandleType handle)
+            {
+                if (!IsValid(handle))
+                    return false;
+
+                Slot& slot = m_Slots[handle.Index];
+                const uint32_t hole = slot.Dense;
+                const uint32_t last = static_cast<uint32_t>(m_Values.size() - 1);
+                if (hole != last)
+                {
+                    m_Values[hole] = std::move(m_Values[last]);
+                    m_DenseToSlot[hole] = m_DenseToSlot[last];
+                    m_Slots[m_DenseToSlot[hole]].Dense = hole;
+                }
+                m_Values.pop_back();
+                m_DenseToSlot.pop_back();
+
+                // Generation 0 is reserved for null handles
+                if (++slot.Generation == 0)
+                    slot.Generation = 1;
+                slot.Dense = NullIndex;
+                slot.NextFree = m_FreeHead;
+                m_FreeHead = handle.Index;
+                return true;
+            }
+
+            bool IsValid(HandleType handle) const noexcept
+            {
+                return handle.Index < m_Slots.size() &&
+                       m_Slots[handle.Index].Generation == handle.Generation &&
+                       m_Slots[handle.Index].Dense != NullIndex;
+            }
+
+            // nullptr for stale or null handles
+            T* Get(HandleType handle) noexcept
+            {
+                return IsValid(handle) ? &m_Values[m_Slots[handle.Index].Dense] : nullptr;
+            }
+
+            const T* Get(HandleType handle) const noexcept
+            {
+                return IsValid(handle) ? &m_Values[m_Slots[handle.Index].Dense] : nullptr;
+            }
+
+            T& operator[](HandleType handle) noexcept
+            {
+                LM_ASSERT_MSG(IsValid(handle), "Stale or null handle (index {}, generation {})", handle.Index, handle.Generation);
+                return m_Values[m_Slots[handle.Index].Dense];
+            }
+
+            const T& operator[](HandleType handle) const noexcept
+            {
+                LM_ASSERT_MSG(IsValid(handle), "Stale or null handle (index {}, generation {})", handle.Index, handle.Generation);
+                return m_Values[m_Slots[handle.Index].Dense];
+            }
+
+            // Handle of the value at a dense position, for iterating with handles
+            HandleType GetHandleAt(size_t denseIndex) const noexcept
+            {
+                const uint32_t index = m_DenseToSlot[denseIndex];
+                return { index, m_Slots[index].Generation };
+            }
+
+            // fn(HandleType, T&) for every live value, in storage order. fn must not create or destroy.
+            template<typename Fn>
+            void ForEach(Fn&& fn)
+            {
+                for (size_t i = 0; i < m_Values.size(); ++i)
+                    fn(GetHandleAt(i), m_Values[i]);
+            }
+
+            // Destroy every value; outstanding handles all become stale
+            void Clear()
+            {
+                for (uint32_t index : m_DenseToSlot)
+                {
+                    Slot& slot = m_Slots[index];
+                    if (++slot.Generation == 0)
+                        slot.Generation = 1;
+                    slot.Dense = NullIndex;
+                    slot.NextFree = m_FreeHead;
+                    m_FreeHead = index;
+                }
+                m_Values.clear();
+                m_DenseToSlot.clear();
+            }
+
+            void Reserve(size_t capacity)
+            {
+                m_Values.reserve(capacity);
+                m_DenseToSlot.reserve(capacity);
+                m_Slots.reserve(capacity);
+            }
+
+            size_t Size() const noexcept { return m_Values.size(); }
+            bool Empty() const noexcept { return m_Values.empty(); }
+            size_t Capacity() const noexcept { return m_Slots.size(); } // Slots ever created
+
+            // Dense iteration over live values (order changes as values are destroyed)
+            T* Data() noexcept { return m_Values.data(); }
+            const T* Data() const noexcept { return m_Values.data(); }
+            auto begin() noexcept { return m_Values.begin(); }
+            auto end() noexcept { return m_Values.end(); }
+            auto begin() const noexcept { return m_Values.begin(); }
+            auto end() const noexcept { return m_Values.end(); }
+
+        private:
+            static constexpr uint32_t NullIndex = ~0u;
+
+            // Geometric growth, so the push_back that follows cannot allocate
+            template<typename U>
+            static void GrowForOneMore(std::vector<U>& vector)
+            {
+                if (vector.size() == vector.capacity())
+                    vector.reserve(vector.empty() ? 8 : vector.size() * 2);
+            }
+
+            struct Slot
+            {
+                uint32_t Dense = NullIndex;      // Position in m_Values, NullIndex while free
+                uint32_t Generation = 1;
+                uint32_t NextFree = NullIndex;   // Free-list link while free
+            };
+
+            std::vector<T> m_Values;
+            std::vector<uint32_t> m_DenseToSlot;
+            std::vector<Slot> m_Slots;
+            uint32_t m_FreeHead = NullIndex;
+        };
+    }
+}
+
+template<typename T>
+struct std::hash<Limitless::Containers::Handle<T>>
+{
+    size_t operator()(const Limitless::Containers::Handle<T>& handle) const noexcept
+    {
+        return std::hash<uint64_t>()((static_cast<uint64_t>(handle.Generation) << 32) | handle.Index);
+    }
+};
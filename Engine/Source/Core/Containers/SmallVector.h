@@ -0,0 +1,269 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Containers
+    {
+        // Vector that keeps its first N elements inline and only allocates beyond that.
+        // Short lists (a node's dependencies, the lights touching a mesh, an entity's components) then live
+        // inside their owner and cost no allocation or pointer chase. Growth past N moves everything to a
+        // heap block from a std::pmr::memory_resource and doubles from there, like std::vector.
+        //
+        // Growth and insertion invalidate pointers and iterators, as with std::vector.
+        template<typename T, size_t N>
+        class SmallVector
+        {
+            static_assert(N > 0, "Use std::pmr::vector for vectors without inline storage");
+
+        public:
+            using value_type = T;
+            using size_type = size_t;
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            explicit SmallVector(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept
+                : m_Resource(resource) {}
+
+            SmallVector(std::initializer_list<T> values, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : m_Resource(resource)
+            {
+                Reserve(values.size());
+                std::uninitialized_copy(values.begin(), values.end(), m_Data);
+                m_Size = values.size();
+            }
+
+            // Copies allocate from the source's resource
+            SmallVector(const SmallVector& other) : m_Resource(other.m_Resource)
+            {
+                Reserve(other.m_Size);
+                std::uninitialized_copy(other.begin(), other.end(), m_Data);
+                m_Size = other.m_Size;
+            }
+
+            SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+                : m_Resource(other.m_Resource)
+            {
+                MoveFrom(other);
+            }
+
+            SmallVector& operator=(const SmallVector& other)
+            {
+                if (this != &other)
+                {
+                    Clear();
+                    Reserve(other.m_Size);
+                    std::uninitialized_copy(other.begin(), other.end(), m_Data);
+                    m_Size = other.m_Size;
+                }
+                return *this;
+            }
+
+            SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+                if (this != &other)
+                {
+                    Clear();
+                    if (other.m_Resource == m_Resource || other.IsInline())
+                    {
+                        FreeHeap();
+                        MoveFrom(other);
+                    }
+                    else
+                    {
+                        // Heap blocks can only be stolen from the same resource
+                        Reserve(other.m_Size);
+                        std::uninitialized_move(other.begin(), other.end(), m_Data);
+                        m_Size = other.m_Size;
+                        other.Clear();
+                    }
+                }
+                return *this;
+            }
+
+            ~SmallVector()
+            {
+                Clear();
+                FreeHeap();
+            }
+
+            template<typename... Args>
+            T& EmplaceBack(Args&&... args)
+            {
+                if (m_Size == m_Capacity)
+                    return GrowAndEmplace(std::forward<Args>(args)...);
+                T* element = new (m_Data + m_Size) T(std::forward<Args>(args)...);
+                ++m_Size;
+                return *element;
+            }
+
+            void PushBack(const T& value) { EmplaceBack(value); }
+            void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+            void PopBack() noexcept
+            {
+                LM_ASSERT_MSG(m_Size > 0, "PopBack on an empty SmallVector");
+                std::destroy_at(m_Data + --m_Size);
+            }
+
+            // Removes the element at position, shifting the rest down; returns the following position
+            iterator Erase(const_iterator position)
+            {
+                T* target = m_Data + (position - m_Data);
+                std::move(target + 1, end(), target);
+                PopBack();
+                return target;
+            }
+
+            // O(1) removal that moves the last element into the hole
+            void SwapErase(size_t index)
+            {
+                LM_ASSERT_MSG(index < m_Size, "SmallVector index {} out of range ({})", index, m_Size);
+                if (index != m_Size - 1)
+                    m_Data[index] = std::move(m_Data[m_Size - 1]);
+                PopBack();
+            }
+
+            // New elements are value-initialized
+            void Resize(size_t size)
+            {
+                if (size > m_Size)
+                {
+                    Reserve(size);
+                    std::uninitialized_value_construct(m_Data + m_Size, m_Data + size);
+                }
+                else
+                {
+                    std::destroy(m_Data + size, m_Data + m_Size);
+                }
+                m_Size = size;
+            }
+
+            void Reserve(size_t capacity)
+            {
+                if (capacity > m_Capacity)
+                    Reallocate(capacity);
+            }
+
+            void Clear() noexcept
+            {
+                std::destroy(m_Data, m_Data + m_Size);
+                m_Size = 0;
+            }
+
+            T& operator[](size_t index) noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "SmallVector index {} out of range ({})", index, m_Size);
+                return m_Data[index];
+            }
+
+            const T& operator[](size_t index) const noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "SmallVector index {} out of range ({})", index, m_Size);
+                return m_Data[index];
+            }
+
+            T& Front() noexcept { return m_Data[0]; }
+            const T& Front() const noexcept { return m_Data[0]; }
+            T& Back() noexcept { return m_Data[m_Size - 1]; }
+            const T& Back() const noexcept { return m_Data[m_Size - 1]; }
+
+            T* Data() noexcept { return m_Data; }
+            const T* Data() const noexcept { return m_Data; }
+            iterator begin() noexcept { return m_Data; }
+            iterator end() noexcept { return m_Data + m_Size; }
+            const_iterator begin() const noexcept { return m_Data; }
+            const_iterator end() const noexcept { return m_Data + m_Size; }
+
+            size_t Size() const noexcept { return m_Size; }
+            bool Empty() const noexcept { return m_Size == 0; }
+            size_t Capacity() const noexcept { return m_Capacity; }
+            bool IsInline() const noexcept { return m_Data == InlineData(); }
+            static constexpr size_t InlineCapacity() noexcept { return N; }
+            std::pmr::memory_resource* GetResource() const noexcept { return m_Resource; }
+
+        private:
+            T* InlineData() noexcept { return reinterpret_cast<T*>(m_Inline); }
+            const T* InlineData() const noexcept { return reinterpret_cast<const T*>(m_Inline); }
+
+            void Reallocate(size_t capacity)
+            {
+                T* data = static_cast<T*>(m_Resource->allocate(capacity * sizeof(T), alignof(T)));
+                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                {
+                    std::uninitialized_move(m_Data, m_Data + m_Size, data);
+                }
+                else
+                {
+                    try
+                    {
+                        std::uninitialized_copy(m_Data, m_Data + m_Size, data);
+                    }
+                    catch (...)
+                    {
+                        m_Resource->deallocate(data, capacity * sizeof(T), alignof(T));
+                        throw;
+                    }
+                }
+                std::destroy(m_Data, m_Data + m_Size);
+                FreeHeap();
+                m_Data = data;
+                m_Capacity = capacity;
+            }
+
+            template<typename... Args>
+            T& GrowAndEmplace(Args&&... args)
+            {
+                // Construct first: args may refer to an element that is about to move
+                T value(std::forward<Args>(args)...);
+                Reallocate(std::max<size_t>(m_Capacity * 2, N));
+                T* element = new (m_Data + m_Size) T(std::move(value));
+                ++m_Size;
+                return *element;
+            }
+
+            void FreeHeap() noexcept
+            {
+                if (!IsInline())
+                {
+                    m_Resource->deallocate(m_Data, m_Capacity * sizeof(T), alignof(T));
+                    m_Data = InlineData();
+                    m_Capacity = N;
+                }
+            }
+
+            // Expects this to be empty and inline
+            void MoveFrom(SmallVector& other)
+            {
+                if (other.IsInline())
+                {
+                    std::uninitialized_move(other.begin(), other.end(), m_Data);
+                    m_Size = other.m_Size;
+                    other.Clear();
+                }
+                else
+                {
+                    m_Data = std::exchange(other.m_Data, other.InlineData());
+                    m_Size = std::exchange(other.m_Size, 0);
+                    m_Capacity = std::exchange(other.m_Capacity, N);
+                }
+            }
+
+            T* m_Data = InlineData();
+            size_t m_Size = 0;
+            size_t m_Capacity = N;
+            std::pmr::memory_resource* m_Resource;
+            alignas(T) std::byte m_Inline[N * sizeof(T)];
+        };
+    }
+}
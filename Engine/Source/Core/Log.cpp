@@ -1,20 +1,92 @@
 #include "lmpch.h"
 #include "Core/Log.h"
+#include "Core/Logging/DeferredLog.h"
+#include "Core/Logging/FlightRecorderSink.h"
+#include "Core/Logging/JsonLinesSink.h"
+#include "Core/Logging/LogSettings.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <chrono>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <optional>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/async.h>
+#include <spdlog/details/periodic_worker.h>
 
 namespace Limitless {
 
     bool Log::s_Initialized = false;
+    std::atomic<bool> Log::s_SuppressDuplicates{ false };
+    std::atomic<bool> Log::s_FlightRecording{ false };
+    std::atomic<spdlog::logger*> Log::s_CoreLogger{ nullptr };
+    std::atomic<spdlog::logger*> Log::s_ClientLogger{ nullptr };
+    std::atomic<uint8_t> Log::s_CategoryLevels[static_cast<size_t>(LogCategory::Count)] = {};
+
+    // Emits the periodic drop and repeat summaries; runs on its own thread so reporting never touches a caller
+    static std::unique_ptr<spdlog::details::periodic_worker> s_DropReporter;
+    static uint64_t s_ReportedDrops = 0;
+
+    // Sinks created by Init, addressable by name from the settings file, and the pattern Init gave each
+    struct NamedSink {
+        std::string Name;
+        spdlog::sink_ptr Sink;
+        std::string Pattern;
+        bool Flight = false;    // Written by Log::WriteFlightRecord on the logging thread; in no logger's list
+    };
+
+    // Settings state, guarded by s_SettingsMutex
+    static std::mutex s_SettingsMutex;
+    static std::vector<NamedSink> s_Sinks;
+    static LogOverflowPolicy s_CoreOverflow = LogOverflowPolicy::DropNewest;
+    static LogOverflowPolicy s_ClientOverflow = LogOverflowPolicy::DropNewest;
+    static std::filesystem::path s_SettingsFile;
+
+    // The flight recorder and whether the settings route each logger to it; read by WriteFlightRecord
+    // under a LoggerGuard, so Shutdown retires the sink instead of freeing it
+    static std::atomic<Logging::FlightRecorderSink*> s_FlightSink{ nullptr };
+    static std::atomic<bool> s_FlightCore{ false };
+    static std::atomic<bool> s_FlightClient{ false };
+
+    // Serializes reloads from the watcher and from Log::ReloadSettings
+    static std::mutex s_ReloadMutex;
+    static bool s_SettingsApplied = false;
+
+    // Polls the settings file; the stamp is only touched by the poll
+    static std::unique_ptr<spdlog::details::periodic_worker> s_SettingsWatcher;
+    static std::optional<std::pair<std::filesystem::file_time_type, std::uintmax_t>> s_SettingsStamp;
+
+    static constexpr const char* s_ConsolePattern = "[%Y-%m-%d %T.%e] [%^%l%$] [%n] %v";
+    static constexpr const char* s_FilePattern = "[%Y-%m-%d %T.%e] [%l] [%n] %v";
+    static constexpr const char* s_FlightPattern = "[%Y-%m-%d %T.%f] [%l] [%n] [%t] %v";
+
+    // Call sites that have suppressed a duplicate at least once; push-only, so walking it needs no lock
+    static std::atomic<LogCallSite*> s_RepeatSites{ nullptr };
+
+    // Mixed into every message hash; FlushRepeatedMessages advances it so no run outlives a report window
+    static std::atomic<uint64_t> s_RepeatEpoch{ 0 };
+
+    // What Init chose for duplicate suppression; the settings file falls back to it
+    static bool s_DefaultSuppressDuplicates = false;
+
+    static constexpr const char* s_CategoryNames[static_cast<size_t>(LogCategory::Count)] = {
+        "Core", "Renderer", "Concurrency", "Memory", "Assets", "Audio", "Input", "Platform"
+    };
+
+    const char* ToString(LogCategory category)
+    {
+        size_t index = static_cast<size_t>(category);
+        return index < static_cast<size_t>(LogCategory::Count) ? s_CategoryNames[index] : "Unknown";
+    }
 
     static std::string BuildLogFilePath(const std::string &logsDirectory,
-                                        const std::string &applicationName)
+                                        const std::string &applicationName,
+                                        const char *extension)
     {
         namespace fs = std::filesystem;
         fs::path dir(logsDirectory);
@@ -23,7 +95,7 @@ namespace Limitless {
             fs::create_directories(dir, ec);
         }
 
-        // Name pattern: <AppName>_YYYY-MM-DD.log (rotation numbers appended by sink)
+        // Name pattern: <AppName>_YYYY-MM-DD<extension> (rotation numbers appended by sink)
         auto now = std::chrono::system_clock::now();
         std::time_t t = std::chrono::system_clock::to_time_t(now);
         std::tm tm_buf{};
@@ -35,86 +107,410 @@ namespace Limitless {
         char datebuf[16]{};
         std::strftime(datebuf, sizeof(datebuf), "%Y-%m-%d", &tm_buf);
 
-        fs::path fileName = applicationName + std::string("_") + datebuf + ".log";
+        fs::path fileName = applicationName + std::string("_") + datebuf + extension;
         return (dir / fileName).string();
     }
 
+    static spdlog::async_overflow_policy ToSpdlog(LogOverflowPolicy policy)
+    {
+        switch (policy) {
+            case LogOverflowPolicy::Block:         return spdlog::async_overflow_policy::block;
+            case LogOverflowPolicy::OverrunOldest: return spdlog::async_overflow_policy::overrun_oldest;
+            case LogOverflowPolicy::DropNewest:    break;
+        }
+        return spdlog::async_overflow_policy::discard_new;
+    }
+
+    static spdlog::level::level_enum ToSpdlog(LogLevel level)
+    {
+        switch (level) {
+            case LogLevel::Trace:    return spdlog::level::trace;
+            case LogLevel::Debug:    return spdlog::level::debug;
+            case LogLevel::Info:     return spdlog::level::info;
+            case LogLevel::Warn:     return spdlog::level::warn;
+            case LogLevel::Error:    return spdlog::level::err;
+            case LogLevel::Critical: return spdlog::level::critical;
+            case LogLevel::Off:      return spdlog::level::off;
+        }
+        return spdlog::level::info;
+    }
+
+    static LogLevel DefaultLevel()
+    {
+#if defined(LM_DEBUG)
+        return LogLevel::Trace;
+#else
+        return LogLevel::Info;
+#endif
+    }
+
+    static NamedSink* FindSink(std::string_view name)
+    {
+        for (auto& sink : s_Sinks) {
+            if (sink.Name == name)
+                return &sink;
+        }
+        return nullptr;
+    }
+
+    static void PollSettings()
+    {
+        std::error_code error;
+        std::optional<std::pair<std::filesystem::file_time_type, std::uintmax_t>> stamp;
+        if (std::filesystem::exists(s_SettingsFile, error)) {
+            auto time = std::filesystem::last_write_time(s_SettingsFile, error);
+            auto size = std::filesystem::file_size(s_SettingsFile, error);
+            if (error)
+                return;     // Mid-replace; look again on the next poll
+            stamp.emplace(time, size);
+        }
+        // Also frees loggers replaced by earlier reloads when no Application is collecting every frame
+        Concurrency::EpochManager::Get().Collect();
+        if (stamp == s_SettingsStamp)
+            return;
+        s_SettingsStamp = stamp;
+        Log::ReloadSettings();
+    }
+
+    // Logs text through logger, recording it in the flight ring first like Log::Write does
+    static void LogText(spdlog::logger *logger, const spdlog::source_loc &location, spdlog::level::level_enum level,
+                        std::string_view text)
+    {
+        if (Log::IsFlightRecording())
+            Log::WriteFlightRecord(logger, location, level, text);
+        logger->log(location, level, spdlog::string_view_t(text.data(), text.size()));
+    }
+
+    // Written straight to the core sinks: the queue is what was full, so the summary must not go through it
+    static void ReportDrops()
+    {
+        uint64_t dropped = Log::GetDroppedCount();
+        uint64_t newDrops = dropped - s_ReportedDrops;
+        if (newDrops == 0)
+            return;
+        s_ReportedDrops = dropped;
+
+        Log::LoggerGuard guard;
+        spdlog::logger* logger = Log::GetCoreLoggerRaw();
+        std::string text = fmt::format("[Core] {} log messages dropped (queue full); {} since startup", newDrops, dropped);
+        if (Log::IsFlightRecording())
+            Log::WriteFlightRecord(logger, {}, spdlog::level::warn, text);
+        spdlog::details::log_msg message(logger->name(), spdlog::level::warn, text);
+        for (auto& sink : logger->sinks()) {
+            if (sink->should_log(message.level))
+                sink->log(message);
+        }
+    }
+
+    // What TakeRepeats hands to ReportRepeats; a fixed buffer, so reporting a run does not allocate
+    struct RepeatSummary {
+        uint32_t Repeats = 0;
+        uint32_t Length = 0;
+        bool HasText = false;
+        char Text[LogCallSite::TextCapacity + 3];   // Room for "..."
+    };
+
+    // Called by the first repeat of a run. Text left Ready by a run whose report found it busy is stale,
+    // so Ready may be overwritten too.
+    static void StoreRepeatedText(LogCallSite &site, std::string_view message)
+    {
+        using Status = LogCallSite::TextStatus;
+        Status state = site.TextState.load(std::memory_order_relaxed);
+        do {
+            if (state == Status::Writing || state == Status::Reading)
+                return;
+        } while (!site.TextState.compare_exchange_weak(state, Status::Writing, std::memory_order_acquire, std::memory_order_relaxed));
+
+        size_t length = std::min(message.size(), LogCallSite::TextCapacity);
+        // Don't split a UTF-8 sequence
+        while (length < message.size() && length > 0 && (static_cast<unsigned char>(message[length]) & 0xC0) == 0x80)
+            --length;
+        std::memcpy(site.Text, message.data(), length);
+        site.TextLength = static_cast<uint32_t>(length);
+        site.TextTruncated = length < message.size();
+        site.TextState.store(Status::Ready, std::memory_order_release);
+    }
+
+    // Takes the pending count, ending the run, and the text if it is ready; returns false if nothing was pending
+    static bool TakeRepeats(LogCallSite &site, RepeatSummary &summary)
+    {
+        using Status = LogCallSite::TextStatus;
+        if (site.Repeats.load(std::memory_order_relaxed) == 0)
+            return false;
+        summary.Repeats = site.Repeats.exchange(0, std::memory_order_relaxed);
+        if (summary.Repeats == 0)
+            return false;
+
+        Status ready = Status::Ready;
+        if (site.TextState.compare_exchange_strong(ready, Status::Reading, std::memory_order_acquire, std::memory_order_relaxed)) {
+            std::memcpy(summary.Text, site.Text, site.TextLength);
+            summary.Length = site.TextLength;
+            if (site.TextTruncated) {
+                std::memcpy(summary.Text + summary.Length, "...", 3);
+                summary.Length += 3;
+            }
+            summary.HasText = true;
+            site.TextState.store(Status::Empty, std::memory_order_release);
+        }
+        return true;
+    }
+
+    static void ReportRepeats(LogCallSite &site, const RepeatSummary &summary)
+    {
+        const spdlog::source_loc location{ site.File, site.Line, "" };
+        fmt::basic_memory_buffer<char, 256> text;
+        if (summary.HasText)
+            fmt::format_to(std::back_inserter(text), "Previous message repeated {} more times: \"{}\"",
+                           summary.Repeats, std::string_view(summary.Text, summary.Length));
+        else
+            fmt::format_to(std::back_inserter(text), "Previous message repeated {} more times", summary.Repeats);
+
+        Log::LoggerGuard guard;
+        LogText(site.GetLogger(), location, site.Level, std::string_view(text.data(), text.size()));
+    }
+
+    bool Log::IsRepeat(LogCallSite &site, std::string_view message)
+    {
+        // Zero is reserved for "nothing logged yet"
+        const uint64_t epoch = s_RepeatEpoch.load(std::memory_order_relaxed);
+        const uint64_t hash = (static_cast<uint64_t>(std::hash<std::string_view>{}(message)) ^ (epoch * 0x9E3779B97F4A7C15ull)) | 1;
+        if (site.LastHash.exchange(hash, std::memory_order_relaxed) == hash) {
+            // Only the first repeat of a run records the text; the rest just count
+            if (site.Repeats.fetch_add(1, std::memory_order_relaxed) == 0)
+                StoreRepeatedText(site, message);
+            if (!site.Listed.exchange(true, std::memory_order_relaxed)) {
+                site.Next = s_RepeatSites.load(std::memory_order_relaxed);
+                while (!s_RepeatSites.compare_exchange_weak(site.Next, &site, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+            return true;
+        }
+
+        // A different message: close the previous run first so the log reads in order. LastHash now
+        // holds this message, which starts the next run. Without a pending run this is one relaxed load.
+        RepeatSummary summary;
+        if (TakeRepeats(site, summary))
+            ReportRepeats(site, summary);
+        return false;
+    }
+
+    void Log::FlushRepeatedMessages()
+    {
+        // New epoch first: from here on no message matches a hash taken before the report
+        s_RepeatEpoch.fetch_add(1, std::memory_order_relaxed);
+        for (LogCallSite* site = s_RepeatSites.load(std::memory_order_acquire); site; site = site->Next) {
+            RepeatSummary summary;
+            if (TakeRepeats(*site, summary))
+                ReportRepeats(*site, summary);
+            site->LastHash.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Log::WriteFlightRecord(spdlog::logger *logger, const spdlog::source_loc &location,
+                                spdlog::level::level_enum level, std::string_view message)
+    {
+        Logging::FlightRecorderSink* sink = s_FlightSink.load(std::memory_order_acquire);
+        if (!sink || !sink->should_log(level))
+            return;
+        // A logger replaced by a reload in the meantime counts as the core logger
+        const bool routed = logger == s_ClientLogger.load(std::memory_order_relaxed)
+            ? s_FlightClient.load(std::memory_order_relaxed) : s_FlightCore.load(std::memory_order_relaxed);
+        if (!routed)
+            return;
+
+        const spdlog::details::log_msg record(location, logger->name(), level, spdlog::string_view_t(message.data(), message.size()));
+        sink->Record(record);
+    }
+
+    bool LogRateLimiter::TryAcquire(double perSecond, uint32_t &suppressed) noexcept
+    {
+        constexpr int64_t second = 1000000000;
+        if (!(perSecond > 0.0)) {
+            Suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const int64_t interval = std::max<int64_t>(static_cast<int64_t>(second / perSecond), 1);
+        const int64_t burstTolerance = std::max<int64_t>(second - interval, 0);
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        // GCRA: admit while the theoretical arrival time is at most one second's worth of messages ahead
+        int64_t next = NextNs.load(std::memory_order_relaxed);
+        for (;;) {
+            const int64_t start = std::max(next, now);
+            if (start - now > burstTolerance) {
+                Suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (NextNs.compare_exchange_weak(next, start + interval, std::memory_order_relaxed))
+                break;
+        }
+        suppressed = Suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
     void Log::Init(const std::string &applicationName,
                    const std::string &logsDirectory,
                    std::size_t maxFileSizeBytes,
                    std::size_t maxRotatedFiles)
+    {
+        LogConfig config;
+        config.LogsDirectory = logsDirectory;
+        config.MaxFileSizeBytes = maxFileSizeBytes;
+        config.MaxRotatedFiles = maxRotatedFiles;
+        Init(applicationName, config);
+    }
+
+    void Log::Init(const std::string &applicationName, const LogConfig &config)
     {
         if (s_Initialized) return;
         s_Initialized = true;
 
-        // Async thread pool (shared across async loggers)
-        // Queue size 8192, 1 background thread. Adjust as needed.
-        spdlog::init_thread_pool(8192, 1);
+        // Async thread pool shared by both loggers
+        spdlog::init_thread_pool(std::max<std::size_t>(config.QueueSize, 1), std::max<std::size_t>(config.ThreadCount, 1));
 
         auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        consoleSink->set_pattern("[%Y-%m-%d %T.%e] [%^%l%$] [%n] %v");
+        consoleSink->set_pattern(s_ConsolePattern);
 
-        auto logfile = BuildLogFilePath(logsDirectory, applicationName);
-        auto rotatingSink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-            logfile, maxFileSizeBytes, maxRotatedFiles
-        );
-        rotatingSink->set_pattern("[%Y-%m-%d %T.%e] [%l] [%n] %v");
+        std::string logfile;
+        spdlog::sink_ptr fileSink;
+        if (config.FileFormat == LogFileFormat::JsonLines) {
+            logfile = BuildLogFilePath(config.LogsDirectory, applicationName, ".jsonl");
+            Logging::JsonLinesSink::Config jsonConfig;
+            jsonConfig.File = logfile;
+            jsonConfig.MaxFileSizeBytes = config.MaxFileSizeBytes;
+            jsonConfig.MaxRotatedFiles = config.MaxRotatedFiles;
+            fileSink = std::make_shared<Logging::JsonLinesSink>(jsonConfig);
+        }
+        else {
+            logfile = BuildLogFilePath(config.LogsDirectory, applicationName, ".log");
+            fileSink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+                logfile, config.MaxFileSizeBytes, config.MaxRotatedFiles
+            );
+            fileSink->set_pattern(s_FilePattern);
+        }
 
-        std::vector<spdlog::sink_ptr> sinks{ consoleSink, rotatingSink };
+        std::vector<spdlog::sink_ptr> sinks{ consoleSink, fileSink };
+        s_Sinks = { { "console", consoleSink, s_ConsolePattern }, { "file", fileSink, s_FilePattern } };
+
+        if (config.FlightRecorderBytes > 0) {
+            try {
+                auto flightFile = std::filesystem::path(config.LogsDirectory) / (applicationName + ".flight");
+                auto flightSink = std::make_shared<Logging::FlightRecorderSink>(flightFile, config.FlightRecorderBytes);
+                flightSink->set_pattern(s_FlightPattern);
+                // Not given to the loggers: a record still in the async queue would be lost in a crash
+                s_Sinks.push_back({ "flight", flightSink, s_FlightPattern, true });
+                s_FlightCore.store(true, std::memory_order_relaxed);
+                s_FlightClient.store(true, std::memory_order_relaxed);
+                s_FlightSink.store(flightSink.get(), std::memory_order_release);
+                s_FlightRecording.store(true, std::memory_order_relaxed);
+            }
+            catch (const std::runtime_error &) {
+                // Already reported by the sink; run without the recorder
+            }
+        }
 
         // Create two loggers sharing sinks: core (engine) and client (application)
         auto coreLogger = std::make_shared<spdlog::async_logger>(
             "LimitlessCore",
             sinks.begin(), sinks.end(),
             spdlog::thread_pool(),
-            spdlog::async_overflow_policy::block
+            ToSpdlog(config.CoreOverflow)
         );
         auto clientLogger = std::make_shared<spdlog::async_logger>(
             applicationName,
             sinks.begin(), sinks.end(),
             spdlog::thread_pool(),
-            spdlog::async_overflow_policy::block
+            ToSpdlog(config.ClientOverflow)
         );
 
         spdlog::register_or_replace(coreLogger);
         spdlog::register_or_replace(clientLogger);
         spdlog::set_default_logger(clientLogger);
 
+        s_CoreOverflow = config.CoreOverflow;
+        s_ClientOverflow = config.ClientOverflow;
+
         // Levels and flushing
-#if defined(LM_DEBUG)
-        spdlog::set_level(spdlog::level::trace);
-#else
-        spdlog::set_level(spdlog::level::info);
-#endif
+        spdlog::set_level(ToSpdlog(DefaultLevel()));
         spdlog::flush_on(spdlog::level::warn);
         spdlog::flush_every(std::chrono::seconds(2));
 
-        spdlog::get("LimitlessCore")->info("Core logger initialized. File: {}", logfile);
-        spdlog::get(applicationName)->info("Client logger initialized. File: {}", logfile);
+        // The registry keeps both loggers alive until Shutdown; the macros use these raw pointers
+        s_CoreLogger.store(coreLogger.get(), std::memory_order_release);
+        s_ClientLogger.store(clientLogger.get(), std::memory_order_release);
+
+        // Backend for the LM_LOG_FAST_* macros; formats into the core logger's sinks
+        if (!Logging::DeferredLog::IsRunning()) {
+            Logging::DeferredLog::Config deferredConfig;
+            deferredConfig.Overflow = config.CoreOverflow;
+            Logging::DeferredLog::Start(deferredConfig);
+        }
+
+        // Suppressed runs are only bounded while the reporter flushes them
+        s_DefaultSuppressDuplicates = config.SuppressDuplicates && config.DropReportInterval.count() > 0;
+        SetSuppressDuplicates(s_DefaultSuppressDuplicates);
+
+        s_ReportedDrops = GetDroppedCount();
+        if (config.DropReportInterval.count() > 0)
+            s_DropReporter = std::make_unique<spdlog::details::periodic_worker>([] {
+                FlushRepeatedMessages();
+                ReportDrops();
+            }, config.DropReportInterval);
+
+        LogText(coreLogger.get(), {}, spdlog::level::info, "Core logger initialized. File: " + logfile);
+        LogText(clientLogger.get(), {}, spdlog::level::info, "Client logger initialized. File: " + logfile);
+
+        // Apply the settings file before anything else logs, then keep watching it
+        if (!config.SettingsFile.empty()) {
+            s_SettingsFile = config.SettingsFile;
+            PollSettings();
+            if (config.SettingsPollInterval.count() > 0)
+                s_SettingsWatcher = std::make_unique<spdlog::details::periodic_worker>(PollSettings, config.SettingsPollInterval);
+        }
     }
 
     void Log::Shutdown()
     {
         if (!s_Initialized) return;
-        spdlog::get("LimitlessCore")->info("Logger shutting down");
+        {
+            LoggerGuard guard;
+            LogText(GetCoreLoggerRaw(), {}, spdlog::level::info, "Logger shutting down");
+        }
+        s_SettingsWatcher.reset();
+        Logging::DeferredLog::Stop();
+        s_DropReporter.reset();
+        SetSuppressDuplicates(false);
+        FlushRepeatedMessages();
+        ReportDrops();
+        s_CoreLogger.store(nullptr, std::memory_order_release);
+        s_ClientLogger.store(nullptr, std::memory_order_release);
         spdlog::shutdown();
+        {
+            std::lock_guard lock(s_SettingsMutex);
+            s_FlightRecording.store(false, std::memory_order_relaxed);
+            s_FlightSink.store(nullptr, std::memory_order_release);
+            for (auto& sink : s_Sinks) {
+                // A thread may still be inside WriteFlightRecord
+                if (sink.Flight)
+                    Concurrency::EpochManager::Get().Retire(new spdlog::sink_ptr(std::move(sink.Sink)));
+            }
+            s_Sinks.clear();
+            s_SettingsFile.clear();
+            s_SettingsStamp.reset();
+            s_SettingsApplied = false;
+        }
+        s_DefaultSuppressDuplicates = false;
         s_Initialized = false;
+
+        // Loggers replaced by settings changes still hold the sinks, and the flight sink is retired above;
+        // free them now unless a thread is still inside a logging call (then the next Collect does)
+        for (int i = 0; i < 3; ++i)
+            Concurrency::EpochManager::Get().Collect();
     }
 
     void Log::SetLevel(LogLevel level)
     {
-        using spdlog::level::level_enum;
-        level_enum spdLevel = spdlog::level::info;
-        switch (level) {
-            case LogLevel::Trace:    spdLevel = spdlog::level::trace; break;
-            case LogLevel::Debug:    spdLevel = spdlog::level::debug; break;
-            case LogLevel::Info:     spdLevel = spdlog::level::info; break;
-            case LogLevel::Warn:     spdLevel = spdlog::level::warn; break;
-            case LogLevel::Error:    spdLevel = spdlog::level::err; break;
-            case LogLevel::Critical: spdLevel = spdlog::level::critical; break;
-            case LogLevel::Off:      spdLevel = spdlog::level::off; break;
-        }
-        spdlog::set_level(spdLevel);
+        spdlog::set_level(ToSpdlog(level));
     }
 
     LogLevel Log::GetLevel()
@@ -132,16 +528,141 @@ namespace Limitless {
         }
     }
 
-    spdlog::logger* Log::GetCoreLoggerRaw()
+    uint64_t Log::GetDroppedCount()
     {
-        auto logger = spdlog::get("LimitlessCore");
-        return logger ? logger.get() : spdlog::default_logger_raw();
+        uint64_t dropped = Logging::DeferredLog::GetStats().Dropped;
+        if (s_Initialized) {
+            auto pool = spdlog::thread_pool();
+            if (pool)
+                dropped += pool->overrun_counter() + pool->discard_counter();
+        }
+        return dropped;
     }
 
-    spdlog::logger* Log::GetClientLoggerRaw()
+    void Log::SetCategoryLevel(LogCategory category, LogLevel level)
     {
-        return spdlog::default_logger_raw();
+        size_t index = static_cast<size_t>(category);
+        if (index < static_cast<size_t>(LogCategory::Count))
+            s_CategoryLevels[index].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
     }
-}
 
+    LogLevel Log::GetCategoryLevel(LogCategory category)
+    {
+        size_t index = static_cast<size_t>(category);
+        if (index >= static_cast<size_t>(LogCategory::Count))
+            return LogLevel::Off;
+        return static_cast<LogLevel>(s_CategoryLevels[index].load(std::memory_order_relaxed));
+    }
+
+    bool Log::ReloadSettings()
+    {
+        std::lock_guard lock(s_ReloadMutex);
+        if (!s_Initialized || s_SettingsFile.empty())
+            return false;
 
+        std::error_code ec;
+        if (!std::filesystem::exists(s_SettingsFile, ec)) {
+            if (!s_SettingsApplied)
+                return true;
+            std::string error;
+            ApplySettings(Logging::LogSettings{}, error);
+            s_SettingsApplied = false;
+            LM_LOG_CAT_INFO(Core, "Log settings file '{}' removed; defaults restored", s_SettingsFile.string());
+            return true;
+        }
+
+        Logging::LogSettings settings;
+        std::string error;
+        if (!Logging::LoadLogSettings(s_SettingsFile, settings, error) || !ApplySettings(settings, error)) {
+            LM_LOG_CAT_ERROR(Core, "Ignoring log settings file '{}': {}", s_SettingsFile.string(), error);
+            return false;
+        }
+        s_SettingsApplied = true;
+        LM_LOG_CAT_INFO(Core, "Applied log settings from '{}'", s_SettingsFile.string());
+        return true;
+    }
+
+    bool Log::ApplySettings(const Logging::LogSettings &settings, std::string &error)
+    {
+        std::lock_guard lock(s_SettingsMutex);
+
+        // Validate everything first so a bad file changes nothing
+        if (s_Initialized) {
+            for (const auto& [name, sink] : settings.Sinks) {
+                if (!FindSink(name)) {
+                    error = "unknown sink '" + name + "'";
+                    return false;
+                }
+            }
+            for (const auto* logger : { &settings.Core, &settings.Client }) {
+                for (const auto& name : logger->Sinks.value_or(std::vector<std::string>{})) {
+                    if (!FindSink(name)) {
+                        error = "unknown sink '" + name + "'";
+                        return false;
+                    }
+                }
+            }
+        }
+
+        SetSuppressDuplicates(settings.SuppressDuplicates.value_or(s_DefaultSuppressDuplicates) && s_DropReporter);
+        for (size_t i = 0; i < settings.Categories.size(); ++i) {
+            LogLevel level = settings.Categories[i].value_or(settings.DefaultCategoryLevel.value_or(LogLevel::Trace));
+            SetCategoryLevel(static_cast<LogCategory>(i), level);
+        }
+        if (!s_Initialized)
+            return true;
+
+        for (auto& sink : s_Sinks) {
+            auto it = settings.Sinks.find(sink.Name);
+            const Logging::LogSettings::Sink* overrides = it != settings.Sinks.end() ? &it->second : nullptr;
+            sink.Sink->set_level(ToSpdlog(overrides && overrides->Level ? *overrides->Level : LogLevel::Trace));
+            sink.Sink->set_pattern(overrides && overrides->Pattern ? *overrides->Pattern : sink.Pattern);
+        }
+
+        const LogLevel globalLevel = settings.Level.value_or(DefaultLevel());
+        spdlog::set_level(ToSpdlog(globalLevel));
+
+        auto applyLogger = [&](std::atomic<spdlog::logger*> &slot, std::atomic<bool> &flight,
+                               const Logging::LogSettings::Logger &overrides, LogOverflowPolicy policy) {
+            spdlog::logger* current = slot.load(std::memory_order_acquire);
+            const auto level = ToSpdlog(overrides.Level.value_or(globalLevel));
+
+            std::vector<spdlog::sink_ptr> sinks;
+            bool recorded = false;
+            for (const auto& sink : s_Sinks) {
+                if (overrides.Sinks && std::find(overrides.Sinks->begin(), overrides.Sinks->end(), sink.Name) == overrides.Sinks->end())
+                    continue;
+                if (sink.Flight)
+                    recorded = true;
+                else
+                    sinks.push_back(sink.Sink);
+            }
+            flight.store(recorded, std::memory_order_relaxed);
+            if (sinks == current->sinks()) {
+                current->set_level(level);
+                return;
+            }
+
+            // spdlog's sink list is not safe to change under concurrent logging: publish a new logger instead
+            auto replacement = std::make_shared<spdlog::async_logger>(
+                current->name(), sinks.begin(), sinks.end(), spdlog::thread_pool(), ToSpdlog(policy));
+            replacement->set_level(level);
+            replacement->flush_on(spdlog::level::warn);
+            auto replaced = spdlog::get(current->name());
+            spdlog::register_or_replace(replacement);
+            if (spdlog::default_logger_raw() == current)
+                spdlog::set_default_logger(replacement);
+            slot.store(replacement.get(), std::memory_order_release);
+
+            // Callers inside a logging call may still hold the old pointer (under a LoggerGuard)
+            Concurrency::EpochManager::Get().Retire(new std::shared_ptr<spdlog::logger>(std::move(replaced)));
+        };
+        applyLogger(s_CoreLogger, s_FlightCore, settings.Core, s_CoreOverflow);
+        applyLogger(s_ClientLogger, s_FlightClient, settings.Client, s_ClientOverflow);
+        s_FlightRecording.store(s_FlightSink.load(std::memory_order_relaxed) &&
+                                (s_FlightCore.load(std::memory_order_relaxed) || s_FlightClient.load(std::memory_order_relaxed)),
+                                std::memory_order_relaxed);
+        Concurrency::EpochManager::Get().Collect();
+        return true;
+    }
+}
@@ -1,6 +1,13 @@
 #pragma once
 
+#include "Core/Concurrency/Epoch.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <memory>
 
 // Pull spdlog for clients via this header only. Clients shouldn't include spdlog directly.
@@ -10,10 +17,16 @@
 
 #include <spdlog/fmt/ostr.h>
 
+#if !defined(_MSC_VER) && (defined(__GNUC__) || defined(__clang__))
+    #include <signal.h>     // raise() for LM_DEBUGBREAK; must stay outside the namespace
+#endif
+
 namespace spdlog { class logger; namespace level { enum level_enum : int; } }
 
 namespace Limitless {
 
+    namespace Logging { struct LogSettings; }
+
     enum class LogLevel {
         Trace,
         Debug,
@@ -24,6 +37,98 @@ namespace Limitless {
         Off
     };
 
+    // Engine subsystems with their own runtime level, logged through the LM_LOG_CAT_* macros
+    enum class LogCategory : uint8_t {
+        Core,
+        Renderer,
+        Concurrency,
+        Memory,
+        Assets,
+        Audio,
+        Input,
+        Platform,
+        Count
+    };
+
+    const char* ToString(LogCategory category);
+
+    // What a logging thread does when the async queue is full
+    enum class LogOverflowPolicy : uint8_t {
+        Block,          // Wait for the backend; nothing is lost but the caller stalls on sink speed
+        DropNewest,     // Discard the message being logged
+        OverrunOldest   // Replace the oldest queued message
+    };
+
+    enum class LogFileFormat : uint8_t {
+        Text,       // <App>_<date>.log, same pattern as the console
+        JsonLines   // <App>_<date>.jsonl, one JSON object per record; rotated files are gzip-compressed
+    };
+
+    struct LogConfig {
+        std::string LogsDirectory = "Logs";
+        LogFileFormat FileFormat = LogFileFormat::Text;
+        std::size_t MaxFileSizeBytes = 10 * 1024 * 1024; // 10 MB
+        std::size_t MaxRotatedFiles = 5;
+
+        // Shared async queue (messages) and the threads draining it into the sinks
+        std::size_t QueueSize = 8192;
+        std::size_t ThreadCount = 1;
+
+        // Callers never wait on disk by default; a burst loses messages instead and is reported
+        LogOverflowPolicy CoreOverflow = LogOverflowPolicy::DropNewest;
+        LogOverflowPolicy ClientOverflow = LogOverflowPolicy::DropNewest;
+
+        // Size of the crash-surviving ring in <LogsDirectory>/<App>.flight (0 disables). Recover it with
+        // 'LogTools recover'; the previous run's ring is kept as <App>.flight.prev.
+        std::size_t FlightRecorderBytes = 0;
+
+        // How often a "N log messages dropped" warning is emitted while drops happen (0 disables). Pending
+        // duplicate counts are reported on the same interval.
+        std::chrono::milliseconds DropReportInterval{ 5000 };
+
+        // Collapse identical consecutive messages per call site (see Log::SetSuppressDuplicates)
+        bool SuppressDuplicates = true;
+
+        // Runtime overrides (levels, sinks, patterns; see Logging/LogSettings.h), polled for changes and
+        // re-applied while the process runs. A missing file is fine and may be created later. Empty disables.
+        std::string SettingsFile = "logging.json";
+        std::chrono::milliseconds SettingsPollInterval{ 1000 };
+    };
+
+    // State of one logging macro expansion, used to suppress identical consecutive messages. Static and
+    // constant-initialized; the hot path only touches the relaxed atomics.
+    struct LogCallSite {
+        static constexpr size_t TextCapacity = 96;
+
+        const char* File;
+        int Line;
+        spdlog::level::level_enum Level;
+        spdlog::logger* (*GetLogger)() noexcept;
+        std::atomic<uint64_t> LastHash{ 0 };
+        std::atomic<uint32_t> Repeats{ 0 };
+        std::atomic<bool> Listed{ false };      // Linked into the list FlushRepeatedMessages walks
+        LogCallSite* Next = nullptr;
+
+        // Start of the message being repeated, quoted by the summary. Ownership moves through TextState
+        // with compare-exchange: the first repeat of a run takes Empty or Ready to Writing and publishes
+        // Ready; the report takes Ready to Reading and hands the buffer back as Empty. Neither side waits:
+        // whoever finds the buffer busy goes without, and the summary then has the count alone.
+        enum class TextStatus : uint8_t { Empty, Writing, Ready, Reading };
+        std::atomic<TextStatus> TextState{ TextStatus::Empty };
+        uint32_t TextLength = 0;
+        bool TextTruncated = false;
+        char Text[TextCapacity]{};
+    };
+
+    // Token bucket behind the *_RATE macros: up to perSecond messages per second, bursts included
+    struct LogRateLimiter {
+        std::atomic<int64_t> NextNs{ 0 };       // GCRA theoretical arrival time (steady clock)
+        std::atomic<uint32_t> Suppressed{ 0 };
+
+        // True if a message may be logged now; suppressed receives the count rejected since the last one
+        bool TryAcquire(double perSecond, uint32_t &suppressed) noexcept;
+    };
+
     class Log {
     public:
         // Initialize global async logger with console + rotating file sinks.
@@ -34,6 +139,7 @@ namespace Limitless {
             std::size_t maxFileSizeBytes = 10 * 1024 * 1024, // 10 MB
             std::size_t maxRotatedFiles = 5
         );
+        static void Init(const std::string &applicationName, const LogConfig &config);
 
         // Shutdown logging and stop thread pool.
         static void Shutdown();
@@ -42,41 +148,259 @@ namespace Limitless {
         static void SetLevel(LogLevel level);
         static LogLevel GetLevel();
 
-        // Internal accessors used by macros (raw pointers for SPDLOG_LOGGER_* macros)
-        static spdlog::logger* GetCoreLoggerRaw();
-        static spdlog::logger* GetClientLoggerRaw();
+        // Identical consecutive messages from one call site are logged once; the rest are counted and
+        // reported as 'Previous message repeated N more times: "<text>"' when the site logs something else,
+        // or by FlushRepeatedMessages, which also ends every site's run so an identical message logged
+        // after it is written again. Log::Init enables this when LogConfig::SuppressDuplicates is set and
+        // the periodic reporter runs (DropReportInterval > 0), bounding a run to one interval.
+        static void SetSuppressDuplicates(bool enabled) noexcept { s_SuppressDuplicates.store(enabled, std::memory_order_relaxed); }
+        static bool GetSuppressDuplicates() noexcept { return s_SuppressDuplicates.load(std::memory_order_relaxed); }
+
+        // Report repeat counts still pending at every call site and start a new suppression window
+        static void FlushRepeatedMessages();
+
+        // Format and log through site's logger, applying duplicate suppression. Used by the macros.
+        template<typename... Args>
+        static void Write(LogCallSite &site, spdlog::format_string_t<Args...> format, Args &&...args) {
+            spdlog::logger* logger = site.GetLogger();
+            const spdlog::source_loc location{ site.File, site.Line, "" };
+            fmt::basic_memory_buffer<char, 256> buffer;
+            try {
+                fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+            }
+            catch (const std::exception &e) {
+                logger->log(location, site.Level, "Failed to format log message: {}", e.what());
+                return;
+            }
+
+            const std::string_view message(buffer.data(), buffer.size());
+            if (GetSuppressDuplicates() && IsRepeat(site, message))
+                return;
+            if (IsFlightRecording())
+                WriteFlightRecord(logger, location, site.Level, message);
+            logger->log(location, site.Level, spdlog::string_view_t(message.data(), message.size()));
+        }
+
+        // The flight recorder (LogConfig::FlightRecorderBytes) is written on the logging thread, before the
+        // message is queued, so a record is in the ring even if the process dies before the queue drains.
+        // Write and DeferredLog call WriteFlightRecord, which stores message if the settings route logger's
+        // output to the "flight" sink and its level passes. Hold a LoggerGuard across the call.
+        static bool IsFlightRecording() noexcept { return s_FlightRecording.load(std::memory_order_relaxed); }
+        static void WriteFlightRecord(spdlog::logger *logger, const spdlog::source_loc &location,
+                                      spdlog::level::level_enum level, std::string_view message);
+
+        // Re-read LogConfig::SettingsFile now rather than on the next poll. Returns false, keeping the
+        // current settings, if the file cannot be parsed or names an unknown sink.
+        static bool ReloadSettings();
+
+        // Apply settings as a whole: everything is validated before anything changes, and whatever the
+        // settings leave out returns to its Init default. Logger and sink entries need Init.
+        static bool ApplySettings(const Logging::LogSettings &settings, std::string &error);
+
+        // Messages lost to a full queue since Init, across the async loggers and the LM_LOG_FAST_* backend
+        static uint64_t GetDroppedCount();
+
+        // Per-category level, applied on top of the global level. Categories start at Trace.
+        static void SetCategoryLevel(LogCategory category, LogLevel level);
+        static LogLevel GetCategoryLevel(LogCategory category);
+
+        // Checked by the LM_LOG_CAT_* macros before any argument is evaluated: a single relaxed load
+        static bool IsCategoryEnabled(LogCategory category, LogLevel level) noexcept {
+            return static_cast<uint8_t>(level) >= s_CategoryLevels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+        }
+
+        // Internal accessors used by the macros and their LogCallSite.
+        // Resolved once by Init; before Init and after Shutdown they fall back to spdlog's default logger.
+        // A settings change can replace the logger, so hold a LoggerGuard for as long as the returned
+        // pointer is in use: the replaced logger is retired to the EpochManager and only freed once every
+        // guard that could have seen it is gone.
+        using LoggerGuard = Concurrency::EpochManager::Guard;
+
+        static spdlog::logger* GetCoreLoggerRaw() noexcept {
+            spdlog::logger* logger = s_CoreLogger.load(std::memory_order_acquire);
+            return logger ? logger : spdlog::default_logger_raw();
+        }
+
+        static spdlog::logger* GetClientLoggerRaw() noexcept {
+            spdlog::logger* logger = s_ClientLogger.load(std::memory_order_acquire);
+            return logger ? logger : spdlog::default_logger_raw();
+        }
 
     private:
+        static bool IsRepeat(LogCallSite &site, std::string_view message);
+
         static bool s_Initialized;
+        static std::atomic<bool> s_SuppressDuplicates;
+        static std::atomic<bool> s_FlightRecording;
+        static std::atomic<spdlog::logger*> s_CoreLogger;
+        static std::atomic<spdlog::logger*> s_ClientLogger;
+        static std::atomic<uint8_t> s_CategoryLevels[static_cast<size_t>(LogCategory::Count)];
     };
 
     // Platform debug break helper
 #if defined(_MSC_VER)
     #define LM_DEBUGBREAK() __debugbreak()
 #elif defined(__GNUC__) || defined(__clang__)
-    #include <signal.h>
     #define LM_DEBUGBREAK() raise(SIGTRAP)
 #else
     #define LM_DEBUGBREAK() ((void)0)
 #endif
 
     // Logger macros (compiled out according to SPDLOG_ACTIVE_LEVEL)
+    // Each expansion owns a static LogCallSite; arguments are only evaluated when the level is enabled.
+    #define LM_LOG_SITE_WRITE(getLogger, spdlogLevel, ...)                                                      \
+        do {                                                                                                    \
+            static ::Limitless::LogCallSite lmLogSite{ __FILE__, __LINE__,                                      \
+                static_cast<::spdlog::level::level_enum>(spdlogLevel), &::Limitless::Log::getLogger };          \
+            ::Limitless::Log::LoggerGuard lmLoggerGuard;                                                        \
+            if (::Limitless::Log::getLogger()->should_log(lmLogSite.Level))                                     \
+                ::Limitless::Log::Write(lmLogSite, __VA_ARGS__);                                                \
+        } while (0)
+
+    #define LM_LOG_SITE_IMPL(getLogger, spdlogLevel, ...)                                                       \
+        do {                                                                                                    \
+            if constexpr (SPDLOG_ACTIVE_LEVEL <= spdlogLevel)                                                   \
+                LM_LOG_SITE_WRITE(getLogger, spdlogLevel, __VA_ARGS__);                                         \
+        } while (0)
+
     // Use default logger configured by Log::Init
     // Client (game/app) logger macros
-    #define LM_LOG_TRACE(...)    SPDLOG_LOGGER_TRACE(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
-    #define LM_LOG_DEBUG(...)    SPDLOG_LOGGER_DEBUG(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
-    #define LM_LOG_INFO(...)     SPDLOG_LOGGER_INFO(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
-    #define LM_LOG_WARN(...)     SPDLOG_LOGGER_WARN(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
-    #define LM_LOG_ERROR(...)    SPDLOG_LOGGER_ERROR(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
-    #define LM_LOG_CRITICAL(...) SPDLOG_LOGGER_CRITICAL(::Limitless::Log::GetClientLoggerRaw(), __VA_ARGS__)
+    #define LM_LOG_TRACE(...)    LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_TRACE, __VA_ARGS__)
+    #define LM_LOG_DEBUG(...)    LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_DEBUG, __VA_ARGS__)
+    #define LM_LOG_INFO(...)     LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_INFO, __VA_ARGS__)
+    #define LM_LOG_WARN(...)     LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_WARN, __VA_ARGS__)
+    #define LM_LOG_ERROR(...)    LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_ERROR, __VA_ARGS__)
+    #define LM_LOG_CRITICAL(...) LM_LOG_SITE_IMPL(GetClientLoggerRaw, SPDLOG_LEVEL_CRITICAL, __VA_ARGS__)
 
     // Engine (core) logger macros
-    #define LM_CORE_LOG_TRACE(...)    SPDLOG_LOGGER_TRACE(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
-    #define LM_CORE_LOG_DEBUG(...)    SPDLOG_LOGGER_DEBUG(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
-    #define LM_CORE_LOG_INFO(...)     SPDLOG_LOGGER_INFO(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
-    #define LM_CORE_LOG_WARN(...)     SPDLOG_LOGGER_WARN(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
-    #define LM_CORE_LOG_ERROR(...)    SPDLOG_LOGGER_ERROR(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
-    #define LM_CORE_LOG_CRITICAL(...) SPDLOG_LOGGER_CRITICAL(::Limitless::Log::GetCoreLoggerRaw(), __VA_ARGS__)
+    #define LM_CORE_LOG_TRACE(...)    LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_TRACE, __VA_ARGS__)
+    #define LM_CORE_LOG_DEBUG(...)    LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_DEBUG, __VA_ARGS__)
+    #define LM_CORE_LOG_INFO(...)     LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_INFO, __VA_ARGS__)
+    #define LM_CORE_LOG_WARN(...)     LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_WARN, __VA_ARGS__)
+    #define LM_CORE_LOG_ERROR(...)    LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_ERROR, __VA_ARGS__)
+    #define LM_CORE_LOG_CRITICAL(...) LM_LOG_SITE_IMPL(GetCoreLoggerRaw, SPDLOG_LEVEL_CRITICAL, __VA_ARGS__)
+
+    // Throttled variants for per-frame and per-entity code. They wrap any logging macro, and the
+    // skipped calls never evaluate their arguments:
+    //     LM_LOG_EVERY_N(60, LM_CORE_LOG_INFO, "Frame {}", frame);   // 1st, 61st, 121st... call
+    //     LM_LOG_ONCE(LM_CORE_LOG_WARN, "Falling back to software skinning");
+    //     LM_LOG_RATE(2.0, LM_CORE_LOG_ERROR, "Lost packet {}", id); // at most 2 per second
+    // Per-level shorthands follow: LM_CORE_LOG_INFO_EVERY_N(60, ...), LM_LOG_WARN_ONCE(...), ...
+    #define LM_LOG_EVERY_N(n, logMacro, ...)                                                                    \
+        do {                                                                                                    \
+            static std::atomic<uint32_t> lmLogCount{ 0 };                                                       \
+            if (lmLogCount.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(n) == 0)             \
+                logMacro(__VA_ARGS__);                                                                          \
+        } while (0)
+
+    #define LM_LOG_ONCE(logMacro, ...)                                                                          \
+        do {                                                                                                    \
+            static std::atomic<bool> lmLogDone{ false };                                                        \
+            if (!lmLogDone.load(std::memory_order_relaxed) && !lmLogDone.exchange(true, std::memory_order_relaxed)) \
+                logMacro(__VA_ARGS__);                                                                          \
+        } while (0)
+
+    #define LM_LOG_RATE(perSecond, logMacro, ...)                                                               \
+        do {                                                                                                    \
+            static ::Limitless::LogRateLimiter lmLogLimiter;                                                    \
+            uint32_t lmLogSuppressed = 0;                                                                       \
+            if (lmLogLimiter.TryAcquire(perSecond, lmLogSuppressed)) {                                          \
+                if (lmLogSuppressed > 0)                                                                        \
+                    logMacro("{} messages suppressed by rate limit", lmLogSuppressed);                          \
+                logMacro(__VA_ARGS__);                                                                          \
+            }                                                                                                   \
+        } while (0)
+
+    #define LM_LOG_TRACE_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_LOG_TRACE, __VA_ARGS__)
+    #define LM_LOG_DEBUG_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_LOG_DEBUG, __VA_ARGS__)
+    #define LM_LOG_INFO_EVERY_N(n, ...)     LM_LOG_EVERY_N(n, LM_LOG_INFO, __VA_ARGS__)
+    #define LM_LOG_WARN_EVERY_N(n, ...)     LM_LOG_EVERY_N(n, LM_LOG_WARN, __VA_ARGS__)
+    #define LM_LOG_ERROR_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_LOG_ERROR, __VA_ARGS__)
+    #define LM_LOG_CRITICAL_EVERY_N(n, ...) LM_LOG_EVERY_N(n, LM_LOG_CRITICAL, __VA_ARGS__)
+    #define LM_LOG_TRACE_ONCE(...)          LM_LOG_ONCE(LM_LOG_TRACE, __VA_ARGS__)
+    #define LM_LOG_DEBUG_ONCE(...)          LM_LOG_ONCE(LM_LOG_DEBUG, __VA_ARGS__)
+    #define LM_LOG_INFO_ONCE(...)           LM_LOG_ONCE(LM_LOG_INFO, __VA_ARGS__)
+    #define LM_LOG_WARN_ONCE(...)           LM_LOG_ONCE(LM_LOG_WARN, __VA_ARGS__)
+    #define LM_LOG_ERROR_ONCE(...)          LM_LOG_ONCE(LM_LOG_ERROR, __VA_ARGS__)
+    #define LM_LOG_CRITICAL_ONCE(...)       LM_LOG_ONCE(LM_LOG_CRITICAL, __VA_ARGS__)
+    #define LM_LOG_TRACE_RATE(r, ...)       LM_LOG_RATE(r, LM_LOG_TRACE, __VA_ARGS__)
+    #define LM_LOG_DEBUG_RATE(r, ...)       LM_LOG_RATE(r, LM_LOG_DEBUG, __VA_ARGS__)
+    #define LM_LOG_INFO_RATE(r, ...)        LM_LOG_RATE(r, LM_LOG_INFO, __VA_ARGS__)
+    #define LM_LOG_WARN_RATE(r, ...)        LM_LOG_RATE(r, LM_LOG_WARN, __VA_ARGS__)
+    #define LM_LOG_ERROR_RATE(r, ...)       LM_LOG_RATE(r, LM_LOG_ERROR, __VA_ARGS__)
+    #define LM_LOG_CRITICAL_RATE(r, ...)    LM_LOG_RATE(r, LM_LOG_CRITICAL, __VA_ARGS__)
+
+    #define LM_CORE_LOG_TRACE_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_CORE_LOG_TRACE, __VA_ARGS__)
+    #define LM_CORE_LOG_DEBUG_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_CORE_LOG_DEBUG, __VA_ARGS__)
+    #define LM_CORE_LOG_INFO_EVERY_N(n, ...)     LM_LOG_EVERY_N(n, LM_CORE_LOG_INFO, __VA_ARGS__)
+    #define LM_CORE_LOG_WARN_EVERY_N(n, ...)     LM_LOG_EVERY_N(n, LM_CORE_LOG_WARN, __VA_ARGS__)
+    #define LM_CORE_LOG_ERROR_EVERY_N(n, ...)    LM_LOG_EVERY_N(n, LM_CORE_LOG_ERROR, __VA_ARGS__)
+    #define LM_CORE_LOG_CRITICAL_EVERY_N(n, ...) LM_LOG_EVERY_N(n, LM_CORE_LOG_CRITICAL, __VA_ARGS__)
+    #define LM_CORE_LOG_TRACE_ONCE(...)          LM_LOG_ONCE(LM_CORE_LOG_TRACE, __VA_ARGS__)
+    #define LM_CORE_LOG_DEBUG_ONCE(...)          LM_LOG_ONCE(LM_CORE_LOG_DEBUG, __VA_ARGS__)
+    #define LM_CORE_LOG_INFO_ONCE(...)           LM_LOG_ONCE(LM_CORE_LOG_INFO, __VA_ARGS__)
+    #define LM_CORE_LOG_WARN_ONCE(...)           LM_LOG_ONCE(LM_CORE_LOG_WARN, __VA_ARGS__)
+    #define LM_CORE_LOG_ERROR_ONCE(...)          LM_LOG_ONCE(LM_CORE_LOG_ERROR, __VA_ARGS__)
+    #define LM_CORE_LOG_CRITICAL_ONCE(...)       LM_LOG_ONCE(LM_CORE_LOG_CRITICAL, __VA_ARGS__)
+    #define LM_CORE_LOG_TRACE_RATE(r, ...)       LM_LOG_RATE(r, LM_CORE_LOG_TRACE, __VA_ARGS__)
+    #define LM_CORE_LOG_DEBUG_RATE(r, ...)       LM_LOG_RATE(r, LM_CORE_LOG_DEBUG, __VA_ARGS__)
+    #define LM_CORE_LOG_INFO_RATE(r, ...)        LM_LOG_RATE(r, LM_CORE_LOG_INFO, __VA_ARGS__)
+    #define LM_CORE_LOG_WARN_RATE(r, ...)        LM_LOG_RATE(r, LM_CORE_LOG_WARN, __VA_ARGS__)
+    #define LM_CORE_LOG_ERROR_RATE(r, ...)       LM_LOG_RATE(r, LM_CORE_LOG_ERROR, __VA_ARGS__)
+    #define LM_CORE_LOG_CRITICAL_RATE(r, ...)    LM_LOG_RATE(r, LM_CORE_LOG_CRITICAL, __VA_ARGS__)
+
+    // Category macros log through the core logger with the category name prefixed:
+    //     LM_LOG_CAT_INFO(Renderer, "Created {} pipelines", count);
+    // Levels below LM_LOG_CATEGORY_ACTIVE_LEVEL (a LogLevel value) compile to nothing. Dist strips Trace
+    // through Info by default; define LM_LOG_CATEGORY_ACTIVE_LEVEL=6 to strip category logging entirely.
+    // SPDLOG_ACTIVE_LEVEL does not apply, so a release build can still enable a category's trace output
+    // at runtime (Log::SetCategoryLevel, logging.json).
+    #if !defined(LM_LOG_CATEGORY_ACTIVE_LEVEL)
+        #if defined(LM_DIST)
+            #define LM_LOG_CATEGORY_ACTIVE_LEVEL 3
+        #else
+            #define LM_LOG_CATEGORY_ACTIVE_LEVEL 0
+        #endif
+    #endif
+
+    #define LM_LOG_CAT_IMPL(spdlogLevel, level, category, fmt, ...)                                           \
+        do {                                                                                                    \
+            if (::Limitless::Log::IsCategoryEnabled(::Limitless::LogCategory::category, ::Limitless::LogLevel::level)) \
+                LM_LOG_SITE_WRITE(GetCoreLoggerRaw, spdlogLevel, "[" #category "] " fmt, ##__VA_ARGS__);        \
+        } while (0)
+
+    #define LM_LOG_CAT_STRIPPED(...) do { } while (0)
+
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 0
+        #define LM_LOG_CAT_TRACE(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_TRACE, Trace, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_TRACE(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 1
+        #define LM_LOG_CAT_DEBUG(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_DEBUG, Debug, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_DEBUG(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 2
+        #define LM_LOG_CAT_INFO(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_INFO, Info, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_INFO(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 3
+        #define LM_LOG_CAT_WARN(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_WARN, Warn, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_WARN(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 4
+        #define LM_LOG_CAT_ERROR(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_ERROR, Error, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_ERROR(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
+    #if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 5
+        #define LM_LOG_CAT_CRITICAL(category, fmt, ...) LM_LOG_CAT_IMPL(SPDLOG_LEVEL_CRITICAL, Critical, category, fmt, ##__VA_ARGS__)
+    #else
+        #define LM_LOG_CAT_CRITICAL(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+    #endif
 
     // Assertion macros that log with context and break in debug builds
     #if defined(LM_DEBUG)
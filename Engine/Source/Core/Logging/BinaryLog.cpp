@@ -0,0 +1,238 @@
+#include "lmpch.h"
+#include "Core/Logging/BinaryLog.h"
+
+#include <spdlog/fmt/bundled/args.h>
+
+#include <cstring>
+#include <iterator>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        namespace
+        {
+            class PayloadCursor
+            {
+            public:
+                explicit PayloadCursor(std::span<const std::byte> bytes) noexcept : m_Bytes(bytes) {}
+
+                template<typename T>
+                bool Read(T& value) noexcept
+                {
+                    if (m_Bytes.size() - m_Offset < sizeof(T))
+                        return false;
+                    std::memcpy(&value, m_Bytes.data() + m_Offset, sizeof(T));
+                    m_Offset += sizeof(T);
+                    return true;
+                }
+
+                bool ReadString(std::string_view& value) noexcept
+                {
+                    uint32_t length = 0;
+                    if (!Read(length) || m_Bytes.size() - m_Offset < length)
+                        return false;
+                    value = std::string_view(reinterpret_cast<const char*>(m_Bytes.data() + m_Offset), length);
+                    m_Offset += length;
+                    return true;
+                }
+
+            private:
+                std::span<const std::byte> m_Bytes;
+                size_t m_Offset = 0;
+            };
+
+            template<typename T>
+            bool Push(PayloadCursor& cursor, fmt::dynamic_format_arg_store<fmt::format_context>& store)
+            {
+                T value{};
+                if (!cursor.Read(value))
+                    return false;
+                store.push_back(value);
+                return true;
+            }
+        }
+
+        void FormatArguments(std::string& out, std::string_view format, std::span<const ArgType> types,
+                             std::span<const std::byte> payload)
+        {
+            fmt::dynamic_format_arg_store<fmt::format_context> store;
+            store.reserve(types.size(), 0);
+            PayloadCursor cursor(payload);
+
+            bool valid = true;
+            for (ArgType type : types)
+            {
+                switch (type)
+                {
+                    case ArgType::Bool:    valid = Push<bool>(cursor, store); break;
+                    case ArgType::Char:    valid = Push<char>(cursor, store); break;
+                    case ArgType::I8:      valid = Push<int8_t>(cursor, store); break;
+                    case ArgType::I16:     valid = Push<int16_t>(cursor, store); break;
+                    case ArgType::I32:     valid = Push<int32_t>(cursor, store); break;
+                    case ArgType::I64:     valid = Push<int64_t>(cursor, store); break;
+                    case ArgType::U8:      valid = Push<uint8_t>(cursor, store); break;
+                    case ArgType::U16:     valid = Push<uint16_t>(cursor, store); break;
+                    case ArgType::U32:     valid = Push<uint32_t>(cursor, store); break;
+                    case ArgType::U64:     valid = Push<uint64_t>(cursor, store); break;
+                    case ArgType::F32:     valid = Push<float>(cursor, store); break;
+                    case ArgType::F64:     valid = Push<double>(cursor, store); break;
+                    case ArgType::Pointer: valid = Push<const void*>(cursor, store); break;
+                    case ArgType::String:
+                    {
+                        std::string_view text;
+                        valid = cursor.ReadString(text);
+                        if (valid)
+                            store.push_back(fmt::string_view(text.data(), text.size()));
+                        break;
+                    }
+                    default:
+                        valid = false;
+                        break;
+                }
+                if (!valid)
+                    break;
+            }
+
+            if (!valid)
+            {
+                out.append("<malformed log arguments> ");
+                out.append(format);
+                return;
+            }
+
+            try
+            {
+                fmt::vformat_to(std::back_inserter(out), fmt::string_view(format.data(), format.size()), store);
+            }
+            catch (const fmt::format_error& e)
+            {
+                out.append("<format error: ");
+                out.append(e.what());
+                out.append("> ");
+                out.append(format);
+            }
+        }
+
+        BinaryLogReader::BinaryLogReader(const std::filesystem::path& path)
+            : m_File(path, std::ios::binary)
+        {
+            if (!m_File)
+            {
+                m_Error = "cannot open '" + path.string() + "'";
+                return;
+            }
+
+            char magic[sizeof(BinaryLogFormat::Magic)]{};
+            uint32_t version = 0, reserved = 0;
+            m_File.read(magic, sizeof(magic));
+            m_File.read(reinterpret_cast<char*>(&version), sizeof(version));
+            m_File.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+            if (!m_File || std::memcmp(magic, BinaryLogFormat::Magic, sizeof(magic)) != 0)
+                m_Error = "'" + path.string() + "' is not a binary log";
+            else if (version != BinaryLogFormat::Version)
+                m_Error = "'" + path.string() + "' has unsupported version " + std::to_string(version);
+        }
+
+        bool BinaryLogReader::Corrupted(const std::string& what)
+        {
+            m_Error = "corrupted " + what + " at offset " + std::to_string(static_cast<long long>(m_RecordStart));
+            return false;
+        }
+
+        bool BinaryLogReader::ReadSite()
+        {
+            uint32_t id = 0, line = 0, fileLength = 0, formatLength = 0;
+            uint8_t level = 0, category = 0;
+            uint16_t argCount = 0;
+            m_File.read(reinterpret_cast<char*>(&id), sizeof(id));
+            m_File.read(reinterpret_cast<char*>(&level), sizeof(level));
+            m_File.read(reinterpret_cast<char*>(&category), sizeof(category));
+            m_File.read(reinterpret_cast<char*>(&line), sizeof(line));
+            m_File.read(reinterpret_cast<char*>(&argCount), sizeof(argCount));
+            if (!m_File)
+                return false;
+            if (id == 0 || id > BinaryLogFormat::MaxSiteId)
+                return Corrupted("site record (id " + std::to_string(id) + ")");
+
+            Site site;
+            site.Level = static_cast<LogLevel>(level);
+            site.Category = static_cast<LogCategory>(category);
+            site.Line = line;
+            site.Types.resize(argCount);
+            m_File.read(reinterpret_cast<char*>(site.Types.data()), argCount);
+
+            m_File.read(reinterpret_cast<char*>(&fileLength), sizeof(fileLength));
+            if (!m_File)
+                return false;
+            if (fileLength > (1u << 16))
+                return Corrupted("site record (file name of " + std::to_string(fileLength) + " bytes)");
+            site.File.resize(fileLength);
+            m_File.read(site.File.data(), fileLength);
+
+            m_File.read(reinterpret_cast<char*>(&formatLength), sizeof(formatLength));
+            if (!m_File)
+                return false;
+            if (formatLength > (1u << 20))
+                return Corrupted("site record (format of " + std::to_string(formatLength) + " bytes)");
+            site.Format.resize(formatLength);
+            m_File.read(site.Format.data(), formatLength);
+            if (!m_File)
+                return false;
+
+            site.Defined = true;
+            if (id >= m_Sites.size())
+                m_Sites.resize(id + 1);
+            m_Sites[id] = std::move(site);
+            return true;
+        }
+
+        bool BinaryLogReader::Next(Entry& entry)
+        {
+            if (!IsOpen())
+                return false;
+
+            for (;;)
+            {
+                m_RecordStart = m_File.tellg();
+                uint8_t kind = 0;
+                if (!m_File.read(reinterpret_cast<char*>(&kind), sizeof(kind)))
+                    return false;
+
+                if (kind == static_cast<uint8_t>(BinaryLogFormat::RecordKind::Site))
+                {
+                    if (!ReadSite())
+                        return false;
+                    continue;
+                }
+                if (kind != static_cast<uint8_t>(BinaryLogFormat::RecordKind::Event))
+                    return Corrupted("record (unknown kind " + std::to_string(kind) + ")");
+
+                uint32_t siteId = 0, payloadSize = 0;
+                m_File.read(reinterpret_cast<char*>(&siteId), sizeof(siteId));
+                m_File.read(reinterpret_cast<char*>(&entry.ThreadId), sizeof(entry.ThreadId));
+                m_File.read(reinterpret_cast<char*>(&entry.TimestampNs), sizeof(entry.TimestampNs));
+                m_File.read(reinterpret_cast<char*>(&payloadSize), sizeof(payloadSize));
+                if (!m_File)
+                    return false;
+                if (siteId >= m_Sites.size() || !m_Sites[siteId].Defined)
+                    return Corrupted("event (undefined site " + std::to_string(siteId) + ")");
+                if (payloadSize > (1u << 24))
+                    return Corrupted("event (payload of " + std::to_string(payloadSize) + " bytes)");
+
+                m_Payload.resize(payloadSize);
+                if (!m_File.read(reinterpret_cast<char*>(m_Payload.data()), payloadSize))
+                    return false;
+
+                const Site& site = m_Sites[siteId];
+                entry.Level = site.Level;
+                entry.Category = site.Category;
+                entry.File = site.File;
+                entry.Line = site.Line;
+                entry.Message.clear();
+                FormatArguments(entry.Message, site.Format, site.Types, m_Payload);
+                return true;
+            }
+        }
+    }
+}
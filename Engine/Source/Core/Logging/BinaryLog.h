@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // How one argument of a deferred log call is stored. The tags are written to binary logs, so the
+        // values are part of the file format: append only.
+        enum class ArgType : uint8_t
+        {
+            Bool, Char,
+            I8, I16, I32, I64,
+            U8, U16, U32, U64,
+            F32, F64,
+            Pointer,
+            String      // uint32 length + bytes; also carries arguments formatted eagerly on the caller
+        };
+
+        template<typename T>
+        constexpr ArgType GetArgType() noexcept
+        {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, bool>)
+                return ArgType::Bool;
+            else if constexpr (std::is_same_v<U, char>)
+                return ArgType::Char;
+            else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+                return sizeof(U) == 1 ? ArgType::I8 : sizeof(U) == 2 ? ArgType::I16 : sizeof(U) == 4 ? ArgType::I32 : ArgType::I64;
+            else if constexpr (std::is_integral_v<U>)
+                return sizeof(U) == 1 ? ArgType::U8 : sizeof(U) == 2 ? ArgType::U16 : sizeof(U) == 4 ? ArgType::U32 : ArgType::U64;
+            else if constexpr (std::is_same_v<U, float>)
+                return ArgType::F32;
+            else if constexpr (std::is_floating_point_v<U>)
+                return ArgType::F64;
+            else if constexpr (std::is_pointer_v<U> && !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<U>>, char>)
+                return ArgType::Pointer;
+            else if constexpr (std::is_same_v<U, std::nullptr_t>)
+                return ArgType::Pointer;
+            else
+                return ArgType::String;
+        }
+
+        // Render format with arguments decoded from payload. Malformed input produces a marker, never throws.
+        void FormatArguments(std::string& out, std::string_view format, std::span<const ArgType> types,
+                             std::span<const std::byte> payload);
+
+        // Binary log file layout (native endianness):
+        //   FileHeader, then a sequence of records, each starting with a RecordKind byte.
+        //   Site:  uint32 id, uint8 level, uint8 category, uint32 line, uint16 argCount, argCount ArgType bytes,
+        //          uint32 fileLength, file, uint32 formatLength, format
+        //   Event: uint32 siteId, uint64 threadId, uint64 timestampNs (system clock), uint32 payloadSize, payload
+        // Sites are written before the first event that references them. A truncated tail (crash mid-write)
+        // is ignored by the reader.
+        namespace BinaryLogFormat
+        {
+            constexpr char Magic[8] = { 'L', 'M', 'B', 'L', 'O', 'G', '0', '1' };
+            constexpr uint32_t Version = 1;
+
+            // Ids are DeferredLog registration indices, so a file may skip some, but none comes near this.
+            // The reader rejects larger ids instead of sizing its site table from a corrupted record.
+            constexpr uint32_t MaxSiteId = 1u << 20;
+
+            enum class RecordKind : uint8_t
+            {
+                Site = 1,
+                Event = 2
+            };
+        }
+
+        // Reads a binary log written by DeferredLog and formats its events
+        class BinaryLogReader
+        {
+        public:
+            struct Entry
+            {
+                LogLevel Level = LogLevel::Info;
+                LogCategory Category = LogCategory::Core;
+                std::string_view File;
+                uint32_t Line = 0;
+                uint64_t ThreadId = 0;
+                uint64_t TimestampNs = 0;
+                std::string Message;
+            };
+
+            // Check IsOpen() afterwards; GetError() explains a failure
+            explicit BinaryLogReader(const std::filesystem::path& path);
+
+            bool IsOpen() const noexcept { return m_Error.empty(); }
+            const std::string& GetError() const noexcept { return m_Error; }
+
+            // Next event, or false at the end of the file or at a truncated record. A record that cannot be
+            // valid also returns false, and leaves IsOpen() false with GetError() naming it and its offset.
+            bool Next(Entry& entry);
+
+        private:
+            struct Site
+            {
+                LogLevel Level = LogLevel::Info;
+                LogCategory Category = LogCategory::Core;
+                uint32_t Line = 0;
+                std::vector<ArgType> Types;
+                std::string File;
+                std::string Format;
+                bool Defined = false;
+            };
+
+            bool ReadSite();
+            bool Corrupted(const std::string& what);    // Sets m_Error, returns false
+
+            std::ifstream m_File;
+            std::streamoff m_RecordStart = 0;
+            std::vector<Site> m_Sites;
+            std::vector<std::byte> m_Payload;
+            std::string m_Error;
+        };
+    }
+}
@@ -0,0 +1,457 @@
+#include "lmpch.h"
+#include "Core/Logging/DeferredLog.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <spdlog/details/os.h>
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        std::atomic<bool> DeferredLog::s_Running{ false };
+
+        namespace
+        {
+            struct SiteInfo
+            {
+                const LogSite* Site = nullptr;
+                const ArgType* Types = nullptr;
+                uint16_t ArgCount = 0;
+            };
+
+            // One producer thread's ring. Shared with the backend so it can be drained after the thread exits.
+            struct ThreadQueue
+            {
+                explicit ThreadQueue(size_t bytes) : Ring(bytes) {}
+
+                Concurrency::SPSCByteRing Ring;
+                uint64_t ThreadId = spdlog::details::os::thread_id();
+                std::atomic<bool> Retired{ false };
+            };
+
+            struct ThreadSlot
+            {
+                std::shared_ptr<ThreadQueue> Queue;
+                uint64_t Generation = 0;   // Backend generation the queue was registered with
+
+                ~ThreadSlot()
+                {
+                    if (Queue)
+                        Queue->Retired.store(true, std::memory_order_release);
+                }
+            };
+
+            struct Backend
+            {
+                std::mutex Mutex;
+                std::condition_variable Wake;
+                std::condition_variable Flushed;
+                std::thread Thread;
+                DeferredLog::Config Settings;
+                bool StopRequested = false;
+                std::atomic<uint64_t> Generation{ 0 }; // Bumped on every Start so stale thread rings are replaced
+                uint64_t FlushRequested = 0;
+                uint64_t FlushCompleted = 0;
+
+                std::vector<SiteInfo> Sites{ 1 };  // Id 0 is never assigned
+                std::vector<std::shared_ptr<ThreadQueue>> Queues;
+
+                std::atomic<uint64_t> Records{ 0 };
+                std::atomic<uint64_t> Blocked{ 0 };
+                std::atomic<uint64_t> Dropped{ 0 };
+                std::atomic<LogOverflowPolicy> Overflow{ LogOverflowPolicy::Block };
+            };
+
+            Backend& GetBackend()
+            {
+                // Intentionally leaked: threads may log during static destruction
+                static Backend* backend = []()
+                {
+                    LM_MEMTAG(Logging);
+                    return new Backend();
+                }();
+                return *backend;
+            }
+
+            thread_local ThreadSlot t_Slot;
+
+            spdlog::level::level_enum ToSpdlog(LogLevel level) noexcept
+            {
+                return static_cast<spdlog::level::level_enum>(level);
+            }
+
+            // Backend-thread state that needs no locking
+            class Writer
+            {
+            public:
+                explicit Writer(const DeferredLog::Config& config) : m_FormatToSinks(config.FormatToSinks)
+                {
+                    if (config.BinaryFile.empty())
+                        return;
+
+                    std::error_code error;
+                    if (config.BinaryFile.has_parent_path())
+                        std::filesystem::create_directories(config.BinaryFile.parent_path(), error);
+
+                    m_Binary.open(config.BinaryFile, std::ios::binary | std::ios::trunc);
+                    if (!m_Binary)
+                    {
+                        LM_LOG_CAT_ERROR(Core, "Failed to open binary log '{}'", config.BinaryFile.string());
+                        return;
+                    }
+                    const uint32_t header[2] = { BinaryLogFormat::Version, 0 };
+                    m_Binary.write(BinaryLogFormat::Magic, sizeof(BinaryLogFormat::Magic));
+                    m_Binary.write(reinterpret_cast<const char*>(header), sizeof(header));
+                }
+
+                void Write(const SiteInfo& site, uint32_t siteId, uint64_t threadId, uint64_t timestampNs,
+                           std::span<const std::byte> payload)
+                {
+                    if (m_Binary.is_open())
+                        WriteBinary(site, siteId, threadId, timestampNs, payload);
+                    if (m_FormatToSinks)
+                        WriteToSinks(site, threadId, timestampNs, payload);
+                }
+
+                void Flush()
+                {
+                    if (m_Binary.is_open())
+                        m_Binary.flush();
+                    if (m_FormatToSinks)
+                    {
+                        Log::LoggerGuard guard;
+                        for (auto& sink : Log::GetCoreLoggerRaw()->sinks())
+                            sink->flush();
+                    }
+                }
+
+            private:
+                void WriteBinary(const SiteInfo& info, uint32_t siteId, uint64_t threadId, uint64_t timestampNs,
+                                 std::span<const std::byte> payload)
+                {
+                    if (siteId >= m_WrittenSites.size())
+                        m_WrittenSites.resize(siteId + 1, false);
+                    if (!m_WrittenSites[siteId])
+                    {
+                        m_WrittenSites[siteId] = true;
+                        const LogSite& site = *info.Site;
+                        const uint8_t kind = static_cast<uint8_t>(BinaryLogFormat::RecordKind::Site);
+                        const uint8_t level = static_cast<uint8_t>(site.Level);
+                        const uint8_t category = static_cast<uint8_t>(site.Category);
+                        const uint32_t fileLength = static_cast<uint32_t>(std::strlen(site.File));
+                        const uint32_t formatLength = static_cast<uint32_t>(std::strlen(site.Format));
+                        Put(kind);
+                        Put(siteId);
+                        Put(level);
+                        Put(category);
+                        Put(site.Line);
+                        Put(info.ArgCount);
+                        m_Binary.write(reinterpret_cast<const char*>(info.Types), info.ArgCount);
+                        Put(fileLength);
+                        m_Binary.write(site.File, fileLength);
+                        Put(formatLength);
+                        m_Binary.write(site.Format, formatLength);
+                    }
+
+                    const uint8_t kind = static_cast<uint8_t>(BinaryLogFormat::RecordKind::Event);
+                    const uint32_t payloadSize = static_cast<uint32_t>(payload.size());
+                    Put(kind);
+                    Put(siteId);
+                    Put(threadId);
+                    Put(timestampNs);
+                    Put(payloadSize);
+                    m_Binary.write(reinterpret_cast<const char*>(payload.data()), payloadSize);
+                }
+
+                void WriteToSinks(const SiteInfo& info, uint64_t threadId, uint64_t timestampNs,
+                                  std::span<const std::byte> payload)
+                {
+                    const LogSite& site = *info.Site;
+                    m_Message.clear();
+                    m_Message.append("[").append(ToString(site.Category)).append("] ");
+                    FormatArguments(m_Message, site.Format, std::span(info.Types, info.ArgCount), payload);
+
+                    Log::LoggerGuard guard;
+                    spdlog::logger* logger = Log::GetCoreLoggerRaw();
+                    spdlog::details::log_msg message(
+                        spdlog::log_clock::time_point(std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds(timestampNs))),
+                        spdlog::source_loc{ site.File, static_cast<int>(site.Line), "" },
+                        logger->name(), ToSpdlog(site.Level), m_Message);
+                    message.thread_id = static_cast<size_t>(threadId);
+
+                    for (auto& sink : logger->sinks())
+                    {
+                        if (sink->should_log(message.level))
+                            sink->log(message);
+                    }
+                    if (message.level >= logger->flush_level())
+                    {
+                        for (auto& sink : logger->sinks())
+                            sink->flush();
+                    }
+                }
+
+                template<typename T>
+                void Put(const T& value)
+                {
+                    m_Binary.write(reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                bool m_FormatToSinks;
+                std::ofstream m_Binary;
+                std::vector<bool> m_WrittenSites;
+                std::string m_Message;
+            };
+
+            // Merge the rings: repeatedly take the oldest head record. Returns the number of records written.
+            size_t Drain(Writer& writer, const std::vector<std::shared_ptr<ThreadQueue>>& queues,
+                         std::vector<SiteInfo>& sites)
+            {
+                size_t written = 0;
+                for (;;)
+                {
+                    ThreadQueue* oldest = nullptr;
+                    std::span<const std::byte> oldestRecord;
+                    uint64_t oldestTime = ~uint64_t(0);
+
+                    for (const auto& queue : queues)
+                    {
+                        std::span<const std::byte> record = queue->Ring.TryRead();
+                        if (record.size() < sizeof(uint64_t) * 2)
+                            continue;
+                        uint64_t timestamp;
+                        std::memcpy(&timestamp, record.data() + sizeof(uint32_t) * 2, sizeof(timestamp));
+                        if (timestamp < oldestTime)
+                        {
+                            oldest = queue.get();
+                            oldestRecord = record;
+                            oldestTime = timestamp;
+                        }
+                    }
+
+                    if (!oldest)
+                        return written;
+
+                    uint32_t siteId;
+                    std::memcpy(&siteId, oldestRecord.data(), sizeof(siteId));
+                    if (siteId >= sites.size())
+                    {
+                        // Registered after our snapshot was taken
+                        Backend& backend = GetBackend();
+                        std::scoped_lock lock(backend.Mutex);
+                        sites = backend.Sites;
+                    }
+
+                    const size_t headerSize = sizeof(uint32_t) * 2 + sizeof(uint64_t);
+                    writer.Write(sites[siteId], siteId, oldest->ThreadId, oldestTime, oldestRecord.subspan(headerSize));
+                    oldest->Ring.Consume();
+                    ++written;
+                }
+            }
+
+            void BackendMain(DeferredLog::Config config)
+            {
+                Backend& backend = GetBackend();
+                Writer writer(config);
+                std::vector<std::shared_ptr<ThreadQueue>> queues;
+                std::vector<SiteInfo> sites;
+
+                for (;;)
+                {
+                    bool stopping;
+                    uint64_t flushTarget;
+                    {
+                        std::scoped_lock lock(backend.Mutex);
+                        // Forget rings whose threads have exited and been fully drained
+                        std::erase_if(backend.Queues, [](const std::shared_ptr<ThreadQueue>& queue)
+                        {
+                            return queue->Retired.load(std::memory_order_acquire) && queue->Ring.IsEmpty();
+                        });
+                        queues = backend.Queues;
+                        if (sites.size() != backend.Sites.size())
+                            sites = backend.Sites;
+                        stopping = backend.StopRequested;
+                        flushTarget = backend.FlushRequested;
+                    }
+
+                    size_t written = Drain(writer, queues, sites);
+                    backend.Records.fetch_add(written, std::memory_order_relaxed);
+
+                    std::unique_lock lock(backend.Mutex);
+                    if (flushTarget != backend.FlushCompleted || stopping)
+                    {
+                        // Everything committed before the request has now been drained
+                        lock.unlock();
+                        writer.Flush();
+                        lock.lock();
+                        backend.FlushCompleted = flushTarget;
+                        backend.Flushed.notify_all();
+                    }
+                    if (stopping)
+                        return;
+                    if (written == 0)
+                    {
+                        backend.Wake.wait_for(lock, config.PollInterval, [&]()
+                        {
+                            return backend.StopRequested || backend.FlushRequested != backend.FlushCompleted;
+                        });
+                    }
+                }
+            }
+        }
+
+        void DeferredLog::Start()
+        {
+            Start(Config{});
+        }
+
+        void DeferredLog::Start(const Config& config)
+        {
+            Stop();
+
+            Backend& backend = GetBackend();
+            {
+                std::scoped_lock lock(backend.Mutex);
+                backend.Settings = config;
+                backend.StopRequested = false;
+                backend.Overflow.store(config.Overflow, std::memory_order_relaxed);
+                ++backend.Generation;
+            }
+            backend.Thread = std::thread(BackendMain, config);
+            s_Running.store(true, std::memory_order_release);
+        }
+
+        void DeferredLog::Stop()
+        {
+            if (!s_Running.exchange(false, std::memory_order_acq_rel))
+                return;
+
+            Backend& backend = GetBackend();
+            {
+                std::scoped_lock lock(backend.Mutex);
+                backend.StopRequested = true;
+            }
+            backend.Wake.notify_all();
+            backend.Thread.join();
+
+            // Threads keep their rings across restarts only if they are re-registered; drop them all
+            std::scoped_lock lock(backend.Mutex);
+            backend.Queues.clear();
+        }
+
+        void DeferredLog::Flush()
+        {
+            if (!IsRunning())
+            {
+                Log::LoggerGuard guard;
+                Log::GetCoreLoggerRaw()->flush();
+                return;
+            }
+
+            Backend& backend = GetBackend();
+            std::unique_lock lock(backend.Mutex);
+            const uint64_t target = ++backend.FlushRequested;
+            backend.Wake.notify_all();
+            backend.Flushed.wait(lock, [&]() { return backend.FlushCompleted >= target || !IsRunning(); });
+        }
+
+        DeferredLog::Stats DeferredLog::GetStats()
+        {
+            Backend& backend = GetBackend();
+            Stats stats;
+            stats.Records = backend.Records.load(std::memory_order_relaxed);
+            stats.Blocked = backend.Blocked.load(std::memory_order_relaxed);
+            stats.Dropped = backend.Dropped.load(std::memory_order_relaxed);
+            std::scoped_lock lock(backend.Mutex);
+            stats.Threads = backend.Queues.size();
+            return stats;
+        }
+
+        uint32_t DeferredLog::RegisterSite(LogSite& site, const ArgType* types, uint16_t count)
+        {
+            Backend& backend = GetBackend();
+            LM_MEMTAG(Logging);
+            std::scoped_lock lock(backend.Mutex);
+
+            // Another thread may have registered it while we waited
+            uint32_t id = site.Id.load(std::memory_order_acquire);
+            if (id != 0)
+                return id;
+
+            id = static_cast<uint32_t>(backend.Sites.size());
+            backend.Sites.push_back({ &site, types, count });
+            site.Id.store(id, std::memory_order_release);
+            return id;
+        }
+
+        std::byte* DeferredLog::Reserve(size_t size, bool& dropped)
+        {
+            Backend& backend = GetBackend();
+            ThreadSlot& slot = t_Slot;
+
+            const uint64_t generation = backend.Generation.load(std::memory_order_acquire);
+            if (!slot.Queue || slot.Generation != generation)
+            {
+                LM_MEMTAG(Logging);
+                std::scoped_lock lock(backend.Mutex);
+                if (slot.Queue)
+                    slot.Queue->Retired.store(true, std::memory_order_release);
+                slot.Queue = std::make_shared<ThreadQueue>(backend.Settings.RingBytesPerThread);
+                slot.Generation = generation;
+                backend.Queues.push_back(slot.Queue);
+            }
+
+            Concurrency::SPSCByteRing& ring = slot.Queue->Ring;
+            if (size > ring.GetMaxRecordSize())
+                return nullptr;
+
+            std::span<std::byte> bytes = ring.Reserve(size);
+            if (bytes.empty() && backend.Overflow.load(std::memory_order_relaxed) != LogOverflowPolicy::Block)
+            {
+                backend.Dropped.fetch_add(1, std::memory_order_relaxed);
+                dropped = true;
+                return nullptr;
+            }
+            if (bytes.empty())
+            {
+                backend.Blocked.fetch_add(1, std::memory_order_relaxed);
+                backend.Wake.notify_one();
+                do
+                {
+                    if (!IsRunning())
+                        return nullptr;
+                    std::this_thread::yield();
+                    bytes = ring.Reserve(size);
+                } while (bytes.empty());
+            }
+            return bytes.data();
+        }
+
+        void DeferredLog::Commit() noexcept
+        {
+            t_Slot.Queue->Ring.Commit();
+        }
+
+        void DeferredLog::WriteImmediate(const LogSite& site, const std::string& message)
+        {
+            Log::LoggerGuard guard;
+            spdlog::logger* logger = Log::GetCoreLoggerRaw();
+            logger->log(spdlog::source_loc{ site.File, static_cast<int>(site.Line), "" }, ToSpdlog(site.Level),
+                        "[{}] {}", ToString(site.Category), message);
+        }
+
+        void DeferredLog::WriteFlightRecord(const LogSite& site, fmt::string_view format, fmt::format_args args)
+        {
+            fmt::basic_memory_buffer<char, 256> message;
+            fmt::format_to(std::back_inserter(message), "[{}] ", ToString(site.Category));
+            fmt::vformat_to(std::back_inserter(message), format, args);
+            Log::WriteFlightRecord(Log::GetCoreLoggerRaw(), spdlog::source_loc{ site.File, static_cast<int>(site.Line), "" },
+                                   ToSpdlog(site.Level), std::string_view(message.data(), message.size()));
+        }
+    }
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Core/Log.h"
+#include "Core/Concurrency/ByteRing.h"
+#include "Core/Logging/BinaryLog.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // Static description of one LM_LOG_FAST_* call site. Ids are assigned on first use; records in the
+        // rings and the binary log refer to the site by id instead of carrying the format string.
+        struct LogSite
+        {
+            LogLevel Level;
+            LogCategory Category;
+            const char* Format;
+            const char* File;
+            uint32_t Line;
+            std::atomic<uint32_t> Id{ 0 };
+        };
+
+        // Low-latency logging backend. A log call captures the site id, a timestamp and the raw argument
+        // bytes into a per-thread SPSCByteRing; formatting happens on a background thread, which merges the
+        // rings in timestamp order and hands finished messages to the core logger's sinks. It can also write
+        // the raw records to a compact binary file instead, decoded later with LogTools.
+        //
+        // Arithmetic values, pointers and strings are copied as-is; any other formattable argument is
+        // formatted to a string on the calling thread, so prefer plain values on hot paths. While the flight
+        // recorder is on, every call is also formatted on the calling thread and stored in its ring first:
+        // a record waiting in a thread's ring would be lost in a crash.
+        //
+        // Log::Init starts the backend with the core logger's overflow policy and Log::Shutdown stops it. Before Start and
+        // after Stop, calls format immediately through the core logger.
+        class DeferredLog
+        {
+        public:
+            struct Config
+            {
+                size_t RingBytesPerThread = 256 * 1024;
+                bool FormatToSinks = true;                  // Format and forward to the core logger's sinks
+                std::filesystem::path BinaryFile;           // Also write raw records here (empty: off)
+                std::chrono::milliseconds PollInterval{ 1 };
+
+                // A full ring drops the record unless this is Block. The backend owns the read side of each
+                // ring, so OverrunOldest cannot be honoured by the producer and behaves as DropNewest.
+                LogOverflowPolicy Overflow = LogOverflowPolicy::DropNewest;
+            };
+
+            struct Stats
+            {
+                uint64_t Records = 0;       // Records processed by the backend
+                uint64_t Blocked = 0;       // Times a producer found its ring full and had to wait
+                uint64_t Dropped = 0;       // Records discarded because a ring was full
+                size_t Threads = 0;         // Producer rings currently registered
+            };
+
+            // Starts the backend thread; a running backend is stopped first (draining it)
+            static void Start();
+            static void Start(const Config& config);
+
+            // Drain everything already logged, then join the backend thread
+            static void Stop();
+
+            static bool IsRunning() noexcept { return s_Running.load(std::memory_order_acquire); }
+
+            // Block until every record logged before the call has been written out
+            static void Flush();
+
+            static Stats GetStats();
+
+            template<typename... Args>
+            static void Write(LogSite& site, fmt::format_string<const Args&...> format, const Args&... args)
+            {
+                {
+                    Log::LoggerGuard guard;
+                    if (!Log::GetCoreLoggerRaw()->should_log(static_cast<spdlog::level::level_enum>(site.Level)))
+                        return;
+                    if (Log::IsFlightRecording())
+                        WriteFlightRecord(site, format.get(), fmt::make_format_args(args...));
+                }
+
+                if (!IsRunning())
+                {
+                    WriteImmediate(site, fmt::vformat(format.get(), fmt::make_format_args(args...)));
+                    return;
+                }
+
+                static constexpr std::array<ArgType, sizeof...(Args)> Types{ GetArgType<Args>()... };
+                uint32_t id = site.Id.load(std::memory_order_acquire);
+                if (id == 0)
+                    id = RegisterSite(site, Types.data(), static_cast<uint16_t>(Types.size()));
+
+                auto prepared = std::make_tuple(Prepare(args)...);
+                const size_t payloadSize = std::apply([](const auto&... values) { return (size_t(0) + ... + EncodedSize(values)); }, prepared);
+
+                bool dropped = false;
+                std::byte* out = Reserve(sizeof(RecordHeader) + payloadSize, dropped);
+                if (dropped)
+                    return;
+                if (!out)
+                {
+                    // Larger than a ring record can hold, or the backend stopped meanwhile
+                    WriteImmediate(site, fmt::vformat(format.get(), fmt::make_format_args(args...)));
+                    return;
+                }
+
+                RecordHeader header{ id, 0, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count()) };
+                std::memcpy(out, &header, sizeof(header));
+                out += sizeof(header);
+                std::apply([&out](const auto&... values) { (Encode(out, values), ...); }, prepared);
+                Commit();
+            }
+
+        private:
+            struct RecordHeader
+            {
+                uint32_t SiteId;
+                uint32_t Reserved;
+                uint64_t TimestampNs;
+            };
+
+            // Reduce an argument to what is stored: the value itself, a view of string data, or a string
+            // formatted now for types the backend cannot reconstruct
+            template<typename T>
+            static auto Prepare(const T& value)
+            {
+                constexpr ArgType type = GetArgType<T>();
+                if constexpr (type == ArgType::String)
+                {
+                    if constexpr (std::is_convertible_v<const T&, const char*>)
+                    {
+                        const char* text = value;
+                        return text ? std::string_view(text) : std::string_view("(null)");
+                    }
+                    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+                        return std::string_view(value);
+                    else
+                        return fmt::format("{}", value);
+                }
+                else if constexpr (type == ArgType::Pointer)
+                    return static_cast<const void*>(value);
+                else if constexpr (type == ArgType::F64)
+                    return static_cast<double>(value);
+                else
+                    return value;
+            }
+
+            template<typename T>
+            static size_t EncodedSize(const T& value) noexcept
+            {
+                if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+                    return sizeof(uint32_t) + value.size();
+                else
+                    return sizeof(T);
+            }
+
+            template<typename T>
+            static void Encode(std::byte*& out, const T& value) noexcept
+            {
+                if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+                {
+                    const uint32_t length = static_cast<uint32_t>(value.size());
+                    std::memcpy(out, &length, sizeof(length));
+                    std::memcpy(out + sizeof(length), value.data(), length);
+                    out += sizeof(length) + length;
+                }
+                else
+                {
+                    std::memcpy(out, &value, sizeof(T));
+                    out += sizeof(T);
+                }
+            }
+
+            static uint32_t RegisterSite(LogSite& site, const ArgType* types, uint16_t count);
+
+            // Reserve bytes in the calling thread's ring, applying the overflow policy while it is full.
+            // nullptr with dropped set when the record was discarded; nullptr alone if it can never fit.
+            static std::byte* Reserve(size_t size, bool& dropped);
+            static void Commit() noexcept;
+
+            static void WriteImmediate(const LogSite& site, const std::string& message);
+            static void WriteFlightRecord(const LogSite& site, fmt::string_view format, fmt::format_args args);
+
+            static std::atomic<bool> s_Running;
+        };
+    }
+}
+
+// Deferred-format logging: LM_LOG_FAST_INFO(Renderer, "Submitted {} draws in {:.2f} ms", count, ms);
+// Filtered by the category's runtime level before anything is captured, and compiled out below
+// LM_LOG_CATEGORY_ACTIVE_LEVEL like the LM_LOG_CAT_* macros.
+#define LM_LOG_FAST_IMPL(level, category, fmt, ...)                                                                   \
+    do {                                                                                                                \
+        if (::Limitless::Log::IsCategoryEnabled(::Limitless::LogCategory::category, ::Limitless::LogLevel::level))     \
+        {                                                                                                               \
+            static ::Limitless::Logging::LogSite lmLogSite{ ::Limitless::LogLevel::level,                              \
+                ::Limitless::LogCategory::category, fmt, __FILE__, static_cast<uint32_t>(__LINE__) };                 \
+            ::Limitless::Logging::DeferredLog::Write(lmLogSite, fmt, ##__VA_ARGS__);                                    \
+        }                                                                                                               \
+    } while (0)
+
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 0
+    #define LM_LOG_FAST_TRACE(category, fmt, ...) LM_LOG_FAST_IMPL(Trace, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_TRACE(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 1
+    #define LM_LOG_FAST_DEBUG(category, fmt, ...) LM_LOG_FAST_IMPL(Debug, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_DEBUG(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 2
+    #define LM_LOG_FAST_INFO(category, fmt, ...) LM_LOG_FAST_IMPL(Info, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_INFO(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 3
+    #define LM_LOG_FAST_WARN(category, fmt, ...) LM_LOG_FAST_IMPL(Warn, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_WARN(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 4
+    #define LM_LOG_FAST_ERROR(category, fmt, ...) LM_LOG_FAST_IMPL(Error, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_ERROR(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
+#if LM_LOG_CATEGORY_ACTIVE_LEVEL <= 5
+    #define LM_LOG_FAST_CRITICAL(category, fmt, ...) LM_LOG_FAST_IMPL(Critical, category, fmt, ##__VA_ARGS__)
+#else
+    #define LM_LOG_FAST_CRITICAL(...) LM_LOG_CAT_STRIPPED(__VA_ARGS__)
+#endif
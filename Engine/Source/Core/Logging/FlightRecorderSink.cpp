@@ -0,0 +1,303 @@
+#include "lmpch.h"
+#include "Core/Logging/FlightRecorderSink.h"
+#include "Core/Logging/Gzip.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        using FlightRecorderFormat::FileHeader;
+        using FlightRecorderFormat::RecordHeader;
+
+        static_assert(sizeof(RecordHeader) == 32, "RecordHeader is part of the file format");
+        static_assert(sizeof(FileHeader) <= FlightRecorderFormat::HeaderSize);
+
+        namespace
+        {
+            constexpr size_t RecordAlignment = 8;
+            constexpr size_t ChecksummedHeaderBytes = offsetof(RecordHeader, Checksum);
+
+            size_t AlignUp(size_t value, size_t alignment) noexcept
+            {
+                return (value + alignment - 1) / alignment * alignment;
+            }
+
+            uint32_t ComputeChecksum(const RecordHeader& header, const std::byte* text) noexcept
+            {
+                uint32_t crc = Crc32(std::span(reinterpret_cast<const std::byte*>(&header), ChecksummedHeaderBytes));
+                return Crc32(std::span(text, header.Length), crc);
+            }
+
+            // Ring bytes can be rewritten by a writer a full lap ahead while a slow one is still copying, so
+            // they are stored as relaxed atomic words: such a clash tears the record, which its checksum
+            // catches, instead of being a data race. destination is 8-byte aligned; the last word is zero-padded.
+            void StoreWords(std::byte* destination, const void* source, size_t size) noexcept
+            {
+                for (size_t i = 0; i < size; i += sizeof(uint64_t))
+                {
+                    uint64_t word = 0;
+                    std::memcpy(&word, static_cast<const std::byte*>(source) + i, std::min(sizeof(word), size - i));
+                    std::atomic_ref(*reinterpret_cast<uint64_t*>(destination + i)).store(word, std::memory_order_relaxed);
+                }
+            }
+
+            // Source of FlightRecorderSink::m_FormatterGeneration: unique across sinks, so a thread's cached
+            // formatter can never be mistaken for the current one of a sink created at the same address
+            std::atomic<uint64_t> s_FormatterGenerations{ 0 };
+
+            // Formatter copy owned by the logging thread, so Record formats without the sink's mutex
+            struct ThreadFormatter
+            {
+                uint64_t Generation = 0;
+                std::unique_ptr<spdlog::formatter> Formatter;
+                spdlog::memory_buf_t Buffer;
+            };
+
+            thread_local ThreadFormatter t_Formatter;
+
+            uint64_t GetProcessId() noexcept
+            {
+#if defined(_WIN32)
+                return GetCurrentProcessId();
+#else
+                return static_cast<uint64_t>(getpid());
+#endif
+            }
+        }
+
+        FlightRecorderSink::FlightRecorderSink(const std::filesystem::path& file, size_t capacityBytes)
+        {
+            std::error_code error;
+            if (file.has_parent_path())
+                std::filesystem::create_directories(file.parent_path(), error);
+
+            // Keep the previous run's recording (it may be the crash being investigated)
+            if (std::filesystem::exists(file, error))
+            {
+                std::filesystem::path previous = file;
+                previous += ".prev";
+                std::filesystem::rename(file, previous, error);
+            }
+
+            m_Capacity = AlignUp(std::max<size_t>(capacityBytes, 4096), 4096);
+            m_MappingSize = FlightRecorderFormat::HeaderSize + m_Capacity;
+
+#if defined(_WIN32)
+            HANDLE fileHandle = CreateFileW(file.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                            nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (fileHandle != INVALID_HANDLE_VALUE)
+            {
+                const ULARGE_INTEGER size{ .QuadPart = m_MappingSize };
+                HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+                if (mappingHandle)
+                {
+                    m_Mapping = static_cast<std::byte*>(MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, m_MappingSize));
+                    m_MappingHandle = mappingHandle;
+                }
+                m_FileHandle = fileHandle;
+            }
+#else
+            m_FileDescriptor = ::open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (m_FileDescriptor >= 0 && ::ftruncate(m_FileDescriptor, static_cast<off_t>(m_MappingSize)) == 0)
+            {
+                void* mapping = ::mmap(nullptr, m_MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_FileDescriptor, 0);
+                m_Mapping = mapping == MAP_FAILED ? nullptr : static_cast<std::byte*>(mapping);
+            }
+#endif
+            if (!m_Mapping)
+            {
+                LM_LOG_CAT_ERROR(Core, "Failed to map flight recorder file '{}'", file.string());
+                Unmap();
+                throw std::runtime_error("FlightRecorderSink could not map its file");
+            }
+
+            m_FormatterGeneration.store(s_FormatterGenerations.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+            // A fresh file reads as zeros, so the ring starts out without any valid record
+            m_Ring = m_Mapping + FlightRecorderFormat::HeaderSize;
+            FileHeader header{};
+            std::memcpy(header.Magic, FlightRecorderFormat::Magic, sizeof(header.Magic));
+            header.Version = FlightRecorderFormat::Version;
+            header.HeaderSize = FlightRecorderFormat::HeaderSize;
+            header.Capacity = m_Capacity;
+            header.ProcessId = GetProcessId();
+            header.StartTimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+            std::memcpy(m_Mapping, &header, sizeof(header));
+        }
+
+        FlightRecorderSink::~FlightRecorderSink()
+        {
+            Unmap();
+        }
+
+        void FlightRecorderSink::Unmap() noexcept
+        {
+#if defined(_WIN32)
+            if (m_Mapping)
+                UnmapViewOfFile(m_Mapping);
+            if (m_MappingHandle)
+                CloseHandle(m_MappingHandle);
+            if (m_FileHandle)
+                CloseHandle(m_FileHandle);
+            m_MappingHandle = m_FileHandle = nullptr;
+#else
+            if (m_Mapping)
+                ::munmap(m_Mapping, m_MappingSize);
+            if (m_FileDescriptor >= 0)
+                ::close(m_FileDescriptor);
+            m_FileDescriptor = -1;
+#endif
+            m_Mapping = nullptr;
+        }
+
+        void FlightRecorderSink::Record(const spdlog::details::log_msg& msg)
+        {
+            ThreadFormatter& local = t_Formatter;
+            if (local.Generation != m_FormatterGeneration.load(std::memory_order_acquire))
+            {
+                std::lock_guard lock(mutex_);
+                local.Formatter = formatter_->clone();
+                local.Generation = m_FormatterGeneration.load(std::memory_order_relaxed);
+            }
+
+            local.Buffer.clear();
+            local.Formatter->format(msg, local.Buffer);
+            Append(msg, local.Buffer);
+        }
+
+        void FlightRecorderSink::sink_it_(const spdlog::details::log_msg& msg)
+        {
+            m_Buffer.clear();
+            formatter_->format(msg, m_Buffer);
+            Append(msg, m_Buffer);
+        }
+
+        void FlightRecorderSink::set_formatter_(std::unique_ptr<spdlog::formatter> formatter)
+        {
+            // Called under the mutex; Record threads pick the new formatter up on their next record
+            formatter_ = std::move(formatter);
+            m_FormatterGeneration.store(s_FormatterGenerations.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        void FlightRecorderSink::Append(const spdlog::details::log_msg& msg, const spdlog::memory_buf_t& text) noexcept
+        {
+            RecordHeader header{};
+            header.Magic = FlightRecorderFormat::RecordMagic;
+            header.Length = static_cast<uint32_t>(std::min(text.size(), m_Capacity / 4));
+            header.Sequence = m_NextSequence.fetch_add(1, std::memory_order_relaxed);
+            header.TimestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                msg.time.time_since_epoch()).count());
+            header.Level = static_cast<uint8_t>(msg.level);
+            header.Checksum = ComputeChecksum(header, reinterpret_cast<const std::byte*>(text.data()));
+
+            // Claim the bytes. A record that would cross the end of the ring claims the rest of it too and
+            // starts at offset 0 instead.
+            const size_t recordSize = AlignUp(sizeof(header) + header.Length, RecordAlignment);
+            uint64_t position = m_WritePosition.load(std::memory_order_relaxed);
+            uint64_t start;
+            do
+            {
+                const size_t offset = static_cast<size_t>(position % m_Capacity);
+                start = offset + recordSize > m_Capacity ? position + (m_Capacity - offset) : position;
+            } while (!m_WritePosition.compare_exchange_weak(position, start + recordSize, std::memory_order_relaxed));
+
+            // Text first, header last: a record torn by a crash, or by a writer a full ring ahead, fails its
+            // checksum either way
+            std::byte* record = m_Ring + static_cast<size_t>(start % m_Capacity);
+            StoreWords(record + sizeof(header), text.data(), header.Length);
+            StoreWords(record, &header, sizeof(header));
+
+            auto* fileHeader = reinterpret_cast<FileHeader*>(m_Mapping);
+            std::atomic_ref(fileHeader->WritePosition).store(start + recordSize, std::memory_order_relaxed);
+            std::atomic_ref(fileHeader->RecordCount).store(header.Sequence, std::memory_order_relaxed);
+        }
+
+        bool RecoverFlightRecording(const std::filesystem::path& file, FlightRecording& recording, std::string& error)
+        {
+            std::ifstream input(file, std::ios::binary);
+            if (!input)
+            {
+                error = "cannot open '" + file.string() + "'";
+                return false;
+            }
+
+            FileHeader header{};
+            input.read(reinterpret_cast<char*>(&header), sizeof(header));
+            if (!input || std::memcmp(header.Magic, FlightRecorderFormat::Magic, sizeof(header.Magic)) != 0)
+            {
+                error = "'" + file.string() + "' is not a flight recorder file";
+                return false;
+            }
+            if (header.Version != FlightRecorderFormat::Version || header.HeaderSize < sizeof(FileHeader))
+            {
+                error = "'" + file.string() + "' has unsupported version " + std::to_string(header.Version);
+                return false;
+            }
+
+            // Size the ring from what the file holds, not from the header: a damaged Capacity must not turn
+            // into a huge allocation, and a truncated copy still yields the records it has
+            std::error_code sizeError;
+            const uint64_t fileSize = std::filesystem::file_size(file, sizeError);
+            if (sizeError || header.HeaderSize > fileSize)
+            {
+                error = "'" + file.string() + "' is truncated or has a corrupted header";
+                return false;
+            }
+            std::vector<std::byte> ring(static_cast<size_t>(std::min(header.Capacity, fileSize - header.HeaderSize)));
+            input.seekg(header.HeaderSize);
+            input.read(reinterpret_cast<char*>(ring.data()), static_cast<std::streamsize>(ring.size()));
+            ring.resize(static_cast<size_t>(input.gcount()));
+
+            recording = {};
+            recording.ProcessId = header.ProcessId;
+            recording.StartTimeNs = header.StartTimeNs;
+
+            // Records never wrap, so every intact one sits at an aligned offset: scan them all
+            for (size_t offset = 0; offset + sizeof(RecordHeader) <= ring.size(); offset += RecordAlignment)
+            {
+                RecordHeader record;
+                std::memcpy(&record, ring.data() + offset, sizeof(record));
+                if (record.Magic != FlightRecorderFormat::RecordMagic || record.Sequence == 0 ||
+                    record.Length > ring.size() - offset - sizeof(record))
+                    continue;
+
+                const std::byte* text = ring.data() + offset + sizeof(record);
+                if (ComputeChecksum(record, text) != record.Checksum)
+                    continue;
+
+                FlightRecord& entry = recording.Records.emplace_back();
+                entry.Sequence = record.Sequence;
+                entry.TimestampNs = record.TimestampNs;
+                entry.Level = static_cast<LogLevel>(std::min<uint8_t>(record.Level, static_cast<uint8_t>(LogLevel::Off)));
+                entry.Text.assign(reinterpret_cast<const char*>(text), record.Length);
+                offset += AlignUp(sizeof(record) + record.Length, RecordAlignment) - RecordAlignment;
+            }
+
+            std::sort(recording.Records.begin(), recording.Records.end(),
+                      [](const FlightRecord& a, const FlightRecord& b) { return a.Sequence < b.Sequence; });
+            if (!recording.Records.empty())
+                recording.LostRecords = recording.Records.back().Sequence - recording.Records.size();
+            return true;
+        }
+    }
+}
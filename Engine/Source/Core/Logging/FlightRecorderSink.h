@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // Crash-surviving sink keeping the last CapacityBytes of formatted records in a memory-mapped ring
+        // file. A record is a memcpy into the shared mapping: no write or flush system calls, so verbose
+        // levels can stay on in production. The kernel owns the dirty pages, so every record copied in before
+        // the process dies (abort, segfault, kill -9) is in the file; only an OS crash or power loss can
+        // lose the tail.
+        //
+        // A record only survives once it is in the mapping, so Log records on the logging thread through
+        // Record, before the message enters the async queue: a record still queued when the process dies
+        // would otherwise be lost, and those last records are the ones a crash investigation needs. Record
+        // takes no lock; each caller reserves its bytes with an atomic and formats with a thread-local copy
+        // of the sink's formatter. Used as a plain spdlog sink it records in sink order instead.
+        //
+        // The ring is only read after the fact, with RecoverFlightRecording or 'LogTools recover <file>'.
+        // A file left by a previous run is renamed to <file>.prev on startup instead of being overwritten.
+        class FlightRecorderSink final : public spdlog::sinks::base_sink<std::mutex>
+        {
+        public:
+            // Throws std::runtime_error if the file cannot be created or mapped
+            FlightRecorderSink(const std::filesystem::path& file, size_t capacityBytes);
+            ~FlightRecorderSink() override;
+
+            FlightRecorderSink(const FlightRecorderSink&) = delete;
+            FlightRecorderSink& operator=(const FlightRecorderSink&) = delete;
+
+            size_t GetCapacity() const noexcept { return m_Capacity; }
+
+            // Format and store msg on the calling thread, bypassing the sink's mutex and spdlog's level
+            // check. Safe to call from any number of threads, alongside log().
+            void Record(const spdlog::details::log_msg& msg);
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override;
+            void flush_() override {}   // Nothing to flush: the mapping is the file
+            void set_formatter_(std::unique_ptr<spdlog::formatter> formatter) override;
+
+        private:
+            void Append(const spdlog::details::log_msg& msg, const spdlog::memory_buf_t& text) noexcept;
+            void Unmap() noexcept;
+
+            std::byte* m_Mapping = nullptr;
+            size_t m_MappingSize = 0;
+            std::byte* m_Ring = nullptr;
+            size_t m_Capacity = 0;
+            std::atomic<uint64_t> m_WritePosition{ 0 };
+            std::atomic<uint64_t> m_NextSequence{ 1 };
+            std::atomic<uint64_t> m_FormatterGeneration{ 0 };   // Changes with the pattern; see Record
+            spdlog::memory_buf_t m_Buffer;                      // sink_it_ only, under the mutex
+#if defined(_WIN32)
+            void* m_FileHandle = nullptr;
+            void* m_MappingHandle = nullptr;
+#else
+            int m_FileDescriptor = -1;
+#endif
+        };
+
+        // Flight recorder file layout (native endianness): a FlightRecorderFormat::FileHeader padded to
+        // HeaderSize, then the ring. Records start at 8-byte aligned offsets and never wrap; a record that
+        // does not fit before the end of the ring starts again at offset 0. Each record is a RecordHeader
+        // followed by Length bytes of formatted text. The checksum covers both, so records torn by the crash
+        // or partly overwritten by the ring are skipped during recovery. Concurrent writers take sequence
+        // numbers and ring space separately, so records are ordered by Sequence, not by offset.
+        namespace FlightRecorderFormat
+        {
+            constexpr char Magic[8] = { 'L', 'M', 'F', 'L', 'I', 'G', 'H', 'T' };
+            constexpr uint32_t Version = 1;
+            constexpr uint32_t HeaderSize = 4096;
+            constexpr uint32_t RecordMagic = 0x4C4D5245; // "LMRE"
+
+            struct FileHeader
+            {
+                char Magic[8];
+                uint32_t Version;
+                uint32_t HeaderSize;
+                uint64_t Capacity;
+                uint64_t ProcessId;
+                uint64_t StartTimeNs;
+                uint64_t WritePosition;     // Total bytes written to the ring; informational
+                uint64_t RecordCount;
+            };
+
+            struct RecordHeader
+            {
+                uint32_t Magic;
+                uint32_t Length;
+                uint64_t Sequence;
+                uint64_t TimestampNs;
+                uint8_t Level;
+                uint8_t Reserved[3];
+                uint32_t Checksum;          // CRC-32 of the header fields above and the text
+            };
+        }
+
+        struct FlightRecord
+        {
+            uint64_t Sequence = 0;
+            uint64_t TimestampNs = 0;
+            LogLevel Level = LogLevel::Info;
+            std::string Text;               // As formatted by the sink's pattern, newline included
+        };
+
+        struct FlightRecording
+        {
+            uint64_t ProcessId = 0;
+            uint64_t StartTimeNs = 0;
+            uint64_t LostRecords = 0;       // Overwritten by the ring, or damaged, before the newest recovered record
+            std::vector<FlightRecord> Records;  // Oldest first
+        };
+
+        // Read every intact record from a flight recorder file. Returns false with error set if the file
+        // cannot be read or is not a flight recorder file.
+        bool RecoverFlightRecording(const std::filesystem::path& file, FlightRecording& recording, std::string& error);
+    }
+}
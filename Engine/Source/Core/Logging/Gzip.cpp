@@ -0,0 +1,261 @@
+#include "lmpch.h"
+#include "Core/Logging/Gzip.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        namespace
+        {
+            constexpr size_t WindowSize = 32 * 1024;
+            constexpr size_t MinMatch = 3;
+            constexpr size_t MaxMatch = 258;
+            constexpr size_t MaxChain = 64;         // Candidates tried per position; bounds the worst case
+            constexpr size_t HashBits = 15;
+
+            constexpr uint16_t LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+            constexpr uint8_t LengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+            constexpr uint16_t DistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+                                                    513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+            constexpr uint8_t DistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+                                                    8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+            const std::array<uint32_t, 256>& GetCrcTable() noexcept
+            {
+                static const std::array<uint32_t, 256> table = []()
+                {
+                    std::array<uint32_t, 256> result{};
+                    for (uint32_t i = 0; i < 256; ++i)
+                    {
+                        uint32_t value = i;
+                        for (int bit = 0; bit < 8; ++bit)
+                            value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+                        result[i] = value;
+                    }
+                    return result;
+                }();
+                return table;
+            }
+
+            class BitWriter
+            {
+            public:
+                explicit BitWriter(std::vector<uint8_t>& out) noexcept : m_Out(out) {}
+
+                // Values are packed least significant bit first
+                void Write(uint32_t value, uint32_t bits)
+                {
+                    m_Buffer |= static_cast<uint64_t>(value) << m_Count;
+                    m_Count += bits;
+                    while (m_Count >= 8)
+                    {
+                        m_Out.push_back(static_cast<uint8_t>(m_Buffer));
+                        m_Buffer >>= 8;
+                        m_Count -= 8;
+                    }
+                }
+
+                // Huffman codes are defined most significant bit first
+                void WriteCode(uint32_t code, uint32_t bits)
+                {
+                    uint32_t reversed = 0;
+                    for (uint32_t i = 0; i < bits; ++i)
+                        reversed |= ((code >> i) & 1u) << (bits - 1 - i);
+                    Write(reversed, bits);
+                }
+
+                void Finish()
+                {
+                    if (m_Count > 0)
+                        m_Out.push_back(static_cast<uint8_t>(m_Buffer));
+                    m_Buffer = 0;
+                    m_Count = 0;
+                }
+
+            private:
+                std::vector<uint8_t>& m_Out;
+                uint64_t m_Buffer = 0;
+                uint32_t m_Count = 0;
+            };
+
+            // Fixed literal/length code (RFC 1951 3.2.6)
+            void WriteSymbol(BitWriter& writer, uint32_t symbol)
+            {
+                if (symbol < 144)
+                    writer.WriteCode(0x30 + symbol, 8);
+                else if (symbol < 256)
+                    writer.WriteCode(0x190 + symbol - 144, 9);
+                else if (symbol < 280)
+                    writer.WriteCode(symbol - 256, 7);
+                else
+                    writer.WriteCode(0xC0 + symbol - 280, 8);
+            }
+
+            template<size_t N, typename T>
+            size_t FindBucket(const T (&bases)[N], uint32_t value) noexcept
+            {
+                return static_cast<size_t>(std::upper_bound(bases, bases + N, value) - bases) - 1;
+            }
+
+            void WriteMatch(BitWriter& writer, uint32_t length, uint32_t distance)
+            {
+                const size_t lengthCode = FindBucket(LengthBase, length);
+                WriteSymbol(writer, 257 + static_cast<uint32_t>(lengthCode));
+                writer.Write(length - LengthBase[lengthCode], LengthExtra[lengthCode]);
+
+                const size_t distanceCode = FindBucket(DistanceBase, distance);
+                writer.WriteCode(static_cast<uint32_t>(distanceCode), 5);
+                writer.Write(distance - DistanceBase[distanceCode], DistanceExtra[distanceCode]);
+            }
+
+            uint32_t Hash(const uint8_t* bytes) noexcept
+            {
+                const uint32_t value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16);
+                return (value * 2654435761u) >> (32 - HashBits);
+            }
+
+            void AppendLittleEndian(std::vector<uint8_t>& out, uint32_t value)
+            {
+                for (int i = 0; i < 4; ++i)
+                    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+            }
+        }
+
+        uint32_t Crc32(std::span<const std::byte> data, uint32_t crc) noexcept
+        {
+            const auto& table = GetCrcTable();
+            crc = ~crc;
+            for (std::byte b : data)
+                crc = table[(crc ^ static_cast<uint8_t>(b)) & 0xFF] ^ (crc >> 8);
+            return ~crc;
+        }
+
+        std::vector<uint8_t> GzipCompress(std::span<const std::byte> data)
+        {
+            std::vector<uint8_t> out;
+            out.reserve(data.size() / 3 + 64);
+
+            // Header: magic, deflate, no flags, no mtime, no extra flags, unknown OS
+            const uint8_t header[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+            out.insert(out.end(), std::begin(header), std::end(header));
+
+            // One final block with fixed Huffman codes
+            BitWriter writer(out);
+            writer.Write(1, 1);
+            writer.Write(1, 2);
+
+            const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+            const size_t size = data.size();
+
+            // Hash chains: head holds the latest position + 1 for each hash, chain links to the previous one
+            std::vector<uint32_t> head(size_t(1) << HashBits, 0);
+            std::vector<uint32_t> chain(WindowSize, 0);
+
+            auto insert = [&](size_t position)
+            {
+                const uint32_t hash = Hash(bytes + position);
+                chain[position & (WindowSize - 1)] = head[hash];
+                head[hash] = static_cast<uint32_t>(position + 1);
+            };
+
+            size_t position = 0;
+            while (position < size)
+            {
+                size_t bestLength = 0;
+                size_t bestDistance = 0;
+
+                if (size - position >= MinMatch)
+                {
+                    const size_t limit = std::min(MaxMatch, size - position);
+                    uint32_t candidate = head[Hash(bytes + position)];
+                    for (size_t tries = 0; candidate != 0 && tries < MaxChain; ++tries)
+                    {
+                        const size_t start = candidate - 1;
+                        const size_t distance = position - start;
+                        if (distance > WindowSize - 1)
+                            break;
+
+                        size_t length = 0;
+                        while (length < limit && bytes[start + length] == bytes[position + length])
+                            ++length;
+                        if (length > bestLength)
+                        {
+                            bestLength = length;
+                            bestDistance = distance;
+                            if (length == limit)
+                                break;
+                        }
+
+                        const uint32_t next = chain[start & (WindowSize - 1)];
+                        if (next >= candidate)
+                            break;  // Slot was overwritten by a newer position
+                        candidate = next;
+                    }
+                }
+
+                if (bestLength >= MinMatch)
+                {
+                    WriteMatch(writer, static_cast<uint32_t>(bestLength), static_cast<uint32_t>(bestDistance));
+                    const size_t end = position + bestLength;
+                    for (; position < end; ++position)
+                    {
+                        if (size - position >= MinMatch)
+                            insert(position);
+                    }
+                }
+                else
+                {
+                    WriteSymbol(writer, bytes[position]);
+                    if (size - position >= MinMatch)
+                        insert(position);
+                    ++position;
+                }
+            }
+
+            WriteSymbol(writer, 256);
+            writer.Finish();
+
+            AppendLittleEndian(out, Crc32(data));
+            AppendLittleEndian(out, static_cast<uint32_t>(size));
+            return out;
+        }
+
+        bool GzipFile(const std::filesystem::path& source, const std::filesystem::path& destination)
+        {
+            std::ifstream input(source, std::ios::binary);
+            if (!input)
+                return false;
+            std::vector<char> contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+            if (input.bad())
+                return false;
+
+            const std::vector<uint8_t> compressed = GzipCompress(std::as_bytes(std::span(contents)));
+
+            // Write next to the destination and rename, so a crash never leaves a truncated archive behind
+            std::filesystem::path temporary = destination;
+            temporary += ".tmp";
+            {
+                std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+                output.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+                if (!output)
+                    return false;
+            }
+
+            std::error_code error;
+            std::filesystem::rename(temporary, destination, error);
+            if (error)
+            {
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // Minimal gzip (RFC 1952) writer for rotated log files: LZ77 over a 32 KiB window with the fixed
+        // DEFLATE Huffman codes. It trades a few percent of ratio against zlib's dynamic trees for having
+        // no dependency; output is readable by gunzip, zcat and any zlib-based ingestion.
+        std::vector<uint8_t> GzipCompress(std::span<const std::byte> data);
+
+        // Compress source into destination. Returns false (leaving source untouched) on any I/O error.
+        bool GzipFile(const std::filesystem::path& source, const std::filesystem::path& destination);
+
+        uint32_t Crc32(std::span<const std::byte> data, uint32_t crc = 0) noexcept;
+    }
+}
@@ -0,0 +1,508 @@
+#include "lmpch.h"
+#include "Core/Logging/JsonLinesSink.h"
+#include "Core/Logging/Gzip.h"
+#include "Core/Log.h"
+#include "Core/Containers/SmallVector.h"
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        namespace
+        {
+            constexpr std::string_view Extension = ".jsonl";
+            constexpr std::string_view CompressedExtension = ".jsonl.gz";
+
+            void LowerCurrentThreadPriority()
+            {
+#if defined(_WIN32)
+                SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(LM_PLATFORM_LINUX)
+                // Only runs when no other thread wants the core; needs no privileges
+                sched_param param{};
+                pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+            }
+
+            void Append(spdlog::memory_buf_t& out, std::string_view text)
+            {
+                out.append(text.data(), text.data() + text.size());
+            }
+
+            void AppendEscaped(spdlog::memory_buf_t& out, std::string_view text)
+            {
+                static constexpr char Hex[] = "0123456789abcdef";
+                size_t runStart = 0;
+                for (size_t i = 0; i < text.size(); ++i)
+                {
+                    const unsigned char c = static_cast<unsigned char>(text[i]);
+                    if (c >= 0x20 && c != '"' && c != '\\')
+                        continue;
+
+                    Append(out, text.substr(runStart, i - runStart));
+                    runStart = i + 1;
+                    switch (c)
+                    {
+                        case '"':  Append(out, "\\\""); break;
+                        case '\\': Append(out, "\\\\"); break;
+                        case '\n': Append(out, "\\n"); break;
+                        case '\r': Append(out, "\\r"); break;
+                        case '\t': Append(out, "\\t"); break;
+                        default:
+                        {
+                            const char escape[6] = { '\\', 'u', '0', '0', Hex[c >> 4], Hex[c & 0xF] };
+                            Append(out, std::string_view(escape, sizeof(escape)));
+                            break;
+                        }
+                    }
+                }
+                Append(out, text.substr(runStart));
+            }
+
+            // JSON number grammar: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+            bool IsJsonNumber(std::string_view text) noexcept
+            {
+                size_t i = 0;
+                auto digits = [&]()
+                {
+                    const size_t start = i;
+                    while (i < text.size() && text[i] >= '0' && text[i] <= '9')
+                        ++i;
+                    return i - start;
+                };
+
+                if (i < text.size() && text[i] == '-')
+                    ++i;
+                if (i < text.size() && text[i] == '0')
+                    ++i;
+                else if (digits() == 0)
+                    return false;
+                if (i < text.size() && text[i] == '.')
+                {
+                    ++i;
+                    if (digits() == 0)
+                        return false;
+                }
+                if (i < text.size() && (text[i] == 'e' || text[i] == 'E'))
+                {
+                    ++i;
+                    if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+                        ++i;
+                    if (digits() == 0)
+                        return false;
+                }
+                return i == text.size();
+            }
+
+            bool IsKeyChar(char c) noexcept
+            {
+                return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                       c == '_' || c == '.' || c == '-';
+            }
+
+            struct Field
+            {
+                std::string_view Key;
+                std::string_view Value;
+                bool Quoted = false;
+            };
+
+            using FieldList = Containers::SmallVector<Field, 8>;
+
+            // Parse 'key=value key2="quoted value"'; false if any token is not a field
+            bool ParseFields(std::string_view text, FieldList& fields)
+            {
+                size_t i = 0;
+                while (i < text.size())
+                {
+                    if (text[i] == ' ')
+                    {
+                        ++i;
+                        continue;
+                    }
+
+                    Field field;
+                    const size_t keyStart = i;
+                    while (i < text.size() && IsKeyChar(text[i]))
+                        ++i;
+                    if (i == keyStart || i >= text.size() || text[i] != '=')
+                        return false;
+                    field.Key = text.substr(keyStart, i - keyStart);
+                    ++i;
+
+                    if (i < text.size() && text[i] == '"')
+                    {
+                        const size_t valueStart = ++i;
+                        while (i < text.size() && text[i] != '"')
+                            i += (text[i] == '\\' && i + 1 < text.size()) ? 2 : 1;
+                        if (i >= text.size())
+                            return false;
+                        field.Value = text.substr(valueStart, i - valueStart);
+                        field.Quoted = true;
+                        ++i;
+                        if (i < text.size() && text[i] != ' ')
+                            return false;
+                    }
+                    else
+                    {
+                        const size_t valueStart = i;
+                        while (i < text.size() && text[i] != ' ')
+                            ++i;
+                        field.Value = text.substr(valueStart, i - valueStart);
+                    }
+                    fields.PushBack(field);
+                }
+                return !fields.Empty();
+            }
+
+            void AppendFieldValue(spdlog::memory_buf_t& out, const Field& field)
+            {
+                if (!field.Quoted && (IsJsonNumber(field.Value) || field.Value == "true" || field.Value == "false"))
+                {
+                    Append(out, field.Value);
+                    return;
+                }
+
+                out.push_back('"');
+                if (!field.Quoted)
+                {
+                    AppendEscaped(out, field.Value);
+                }
+                else
+                {
+                    // Drop the backslashes of \" and \\ before re-escaping
+                    std::string unescaped;
+                    unescaped.reserve(field.Value.size());
+                    for (size_t i = 0; i < field.Value.size(); ++i)
+                    {
+                        if (field.Value[i] == '\\' && i + 1 < field.Value.size())
+                            ++i;
+                        unescaped.push_back(field.Value[i]);
+                    }
+                    AppendEscaped(out, unescaped);
+                }
+                out.push_back('"');
+            }
+
+            // "YYYY-MM-DDTHH:MM:SS" for the second containing time, cached per thread
+            std::string_view FormatSeconds(std::chrono::system_clock::time_point time)
+            {
+                thread_local std::time_t t_CachedSecond = -1;
+                thread_local char t_Cached[24]{};
+
+                const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+                if (seconds != t_CachedSecond)
+                {
+                    std::tm tm{};
+#if defined(_WIN32)
+                    gmtime_s(&tm, &seconds);
+#else
+                    gmtime_r(&seconds, &tm);
+#endif
+                    std::strftime(t_Cached, sizeof(t_Cached), "%Y-%m-%dT%H:%M:%S", &tm);
+                    t_CachedSecond = seconds;
+                }
+                return t_Cached;
+            }
+
+            // Sequence number of a rotated file named <stem>.<sequence>.jsonl[.gz], or 0
+            uint64_t GetRotatedSequence(const std::filesystem::path& file, const std::string& stem)
+            {
+                const std::string name = file.filename().string();
+                if (name.size() <= stem.size() + 1 || name.compare(0, stem.size(), stem) != 0 || name[stem.size()] != '.')
+                    return 0;
+
+                std::string_view rest = std::string_view(name).substr(stem.size() + 1);
+                if (rest.ends_with(CompressedExtension))
+                    rest.remove_suffix(CompressedExtension.size());
+                else if (rest.ends_with(Extension))
+                    rest.remove_suffix(Extension.size());
+                else
+                    return 0;
+
+                uint64_t sequence = 0;
+                auto [end, error] = std::from_chars(rest.data(), rest.data() + rest.size(), sequence);
+                return (error == std::errc() && end == rest.data() + rest.size()) ? sequence : 0;
+            }
+        }
+
+        // Background thread compressing rotated files and deleting the oldest
+        class JsonLinesSink::Maintenance
+        {
+        public:
+            explicit Maintenance(const Config& config)
+                : m_Config(config), m_Stem(config.File.stem().string()), m_Thread([this]() { Run(); })
+            {
+            }
+
+            ~Maintenance()
+            {
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    m_Stop = true;
+                }
+                m_Wake.notify_one();
+                m_Thread.join();
+            }
+
+            void Submit(std::filesystem::path rotated)
+            {
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    m_Pending.push_back(std::move(rotated));
+                }
+                m_Wake.notify_one();
+            }
+
+            void WaitIdle()
+            {
+                std::unique_lock lock(m_Mutex);
+                m_Idle.wait(lock, [this]() { return m_Pending.empty() && !m_Busy; });
+            }
+
+        private:
+            void Run()
+            {
+                LowerCurrentThreadPriority();
+
+                std::unique_lock lock(m_Mutex);
+                for (;;)
+                {
+                    m_Wake.wait(lock, [this]() { return m_Stop || !m_Pending.empty(); });
+                    if (m_Pending.empty())
+                        return;  // Stopping; queued files are finished first
+
+                    std::filesystem::path file = std::move(m_Pending.front());
+                    m_Pending.pop_front();
+                    m_Busy = true;
+                    lock.unlock();
+
+                    Process(file);
+
+                    lock.lock();
+                    m_Busy = false;
+                    if (m_Pending.empty())
+                        m_Idle.notify_all();
+                }
+            }
+
+            void Process(const std::filesystem::path& file)
+            {
+                // Already pruned when rotation outpaces compression
+                std::error_code error;
+                if (!std::filesystem::exists(file, error))
+                    return;
+
+                if (m_Config.CompressRotated && file.extension() == Extension)
+                {
+                    std::filesystem::path compressed = file;
+                    compressed += ".gz";
+                    if (GzipFile(file, compressed))
+                        std::filesystem::remove(file, error);
+                    else
+                        LM_LOG_CAT_WARN(Core, "Failed to compress rotated log '{}'", file.string());
+                }
+                Prune();
+            }
+
+            // Keep the newest MaxRotatedFiles rotated files
+            void Prune()
+            {
+                std::error_code error;
+                std::vector<std::pair<uint64_t, std::filesystem::path>> rotated;
+                const std::filesystem::path directory = m_Config.File.has_parent_path() ? m_Config.File.parent_path() : ".";
+                for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+                {
+                    if (uint64_t sequence = GetRotatedSequence(entry.path(), m_Stem))
+                        rotated.emplace_back(sequence, entry.path());
+                }
+                if (rotated.size() <= m_Config.MaxRotatedFiles)
+                    return;
+
+                std::sort(rotated.begin(), rotated.end());
+                const size_t excess = rotated.size() - m_Config.MaxRotatedFiles;
+                for (size_t i = 0; i < excess; ++i)
+                    std::filesystem::remove(rotated[i].second, error);
+            }
+
+            Config m_Config;
+            std::string m_Stem;
+            std::mutex m_Mutex;
+            std::condition_variable m_Wake;
+            std::condition_variable m_Idle;
+            std::deque<std::filesystem::path> m_Pending;
+            bool m_Busy = false;
+            bool m_Stop = false;
+            std::thread m_Thread;   // Last: started once everything above is constructed
+        };
+
+        JsonLinesSink::JsonLinesSink(const Config& config)
+            : m_Config(config)
+        {
+            m_File.open(spdlog::filename_t(m_Config.File.string()), false);
+            m_CurrentSize = m_File.size();
+
+            m_Maintenance = std::make_unique<Maintenance>(m_Config);
+
+            // Continue numbering after existing rotated files; finish compressing any a crash left behind
+            std::error_code error;
+            const std::string stem = m_Config.File.stem().string();
+            const std::filesystem::path directory = m_Config.File.has_parent_path() ? m_Config.File.parent_path() : ".";
+            for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+            {
+                if (uint64_t sequence = GetRotatedSequence(entry.path(), stem))
+                {
+                    m_NextSequence = std::max(m_NextSequence, sequence + 1);
+                    if (entry.path().extension() == Extension)
+                        m_Maintenance->Submit(entry.path());
+                }
+            }
+        }
+
+        JsonLinesSink::~JsonLinesSink() = default;
+
+        void JsonLinesSink::WaitForMaintenance()
+        {
+            m_Maintenance->WaitIdle();
+        }
+
+        void JsonLinesSink::FormatRecord(const spdlog::details::log_msg& msg, spdlog::memory_buf_t& out)
+        {
+            std::string_view text(msg.payload.data(), msg.payload.size());
+
+            // "[Category] " prefix from the category macros
+            std::string_view category;
+            if (text.size() > 3 && text.front() == '[')
+            {
+                const size_t close = text.find("] ");
+                if (close != std::string_view::npos)
+                {
+                    const std::string_view name = text.substr(1, close - 1);
+                    for (size_t i = 0; i < static_cast<size_t>(LogCategory::Count); ++i)
+                    {
+                        if (name == ToString(static_cast<LogCategory>(i)))
+                        {
+                            category = name;
+                            text.remove_prefix(close + 2);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // " | key=value ..." suffix
+            FieldList fields;
+            const size_t separator = text.rfind(" | ");
+            if (separator != std::string_view::npos)
+            {
+                if (ParseFields(text.substr(separator + 3), fields))
+                    text = text.substr(0, separator);
+                else
+                    fields.Clear();
+            }
+
+            const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+                msg.time.time_since_epoch()).count() % 1000000;
+            const auto level = spdlog::level::to_string_view(msg.level);
+
+            Append(out, "{\"ts\":\"");
+            Append(out, FormatSeconds(msg.time));
+            fmt::format_to(std::back_inserter(out), ".{:06}Z\",\"level\":\"", microseconds);
+            Append(out, std::string_view(level.data(), level.size()));
+            Append(out, "\",\"logger\":\"");
+            AppendEscaped(out, std::string_view(msg.logger_name.data(), msg.logger_name.size()));
+            fmt::format_to(std::back_inserter(out), "\",\"thread\":{}", msg.thread_id);
+            if (!category.empty())
+            {
+                Append(out, ",\"category\":\"");
+                Append(out, category);
+                out.push_back('"');
+            }
+            Append(out, ",\"msg\":\"");
+            AppendEscaped(out, text);
+            out.push_back('"');
+
+            if (!fields.Empty())
+            {
+                Append(out, ",\"fields\":{");
+                for (size_t i = 0; i < fields.Size(); ++i)
+                {
+                    if (i > 0)
+                        out.push_back(',');
+                    out.push_back('"');
+                    AppendEscaped(out, fields[i].Key);
+                    Append(out, "\":");
+                    AppendFieldValue(out, fields[i]);
+                }
+                out.push_back('}');
+            }
+
+            if (!msg.source.empty())
+            {
+                Append(out, ",\"file\":\"");
+                AppendEscaped(out, msg.source.filename);
+                fmt::format_to(std::back_inserter(out), "\",\"line\":{}", msg.source.line);
+            }
+            Append(out, "}\n");
+        }
+
+        void JsonLinesSink::sink_it_(const spdlog::details::log_msg& msg)
+        {
+            m_Buffer.clear();
+            FormatRecord(msg, m_Buffer);
+
+            if (m_CurrentSize > 0 && m_CurrentSize + m_Buffer.size() > m_Config.MaxFileSizeBytes)
+                Rotate();
+
+            m_File.write(m_Buffer);
+            m_CurrentSize += m_Buffer.size();
+        }
+
+        void JsonLinesSink::flush_()
+        {
+            m_File.flush();
+        }
+
+        void JsonLinesSink::Rotate()
+        {
+            m_File.close();
+
+            const std::filesystem::path rotated = m_Config.File.parent_path() /
+                fmt::format("{}.{:06}{}", m_Config.File.stem().string(), m_NextSequence++, Extension);
+
+            std::error_code error;
+            std::filesystem::rename(m_Config.File, rotated, error);
+            if (error)
+            {
+                // Keep appending to the current file rather than losing records
+                m_File.open(spdlog::filename_t(m_Config.File.string()), false);
+                m_CurrentSize = 0;
+                return;
+            }
+
+            m_File.open(spdlog::filename_t(m_Config.File.string()), true);
+            m_CurrentSize = 0;
+            m_Maintenance->Submit(rotated);
+        }
+    }
+}
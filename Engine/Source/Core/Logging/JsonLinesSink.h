@@ -0,0 +1,66 @@
+#pragma once
+
+#include <spdlog/details/file_helper.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // File sink writing one JSON object per line:
+        //   {"ts":"2026-01-02T03:04:05.678901Z","level":"info","logger":"LimitlessCore","thread":1234,
+        //    "category":"Renderer","msg":"Swapchain recreated","fields":{"width":1920,"height":1080}}
+        //
+        // "category" comes from the "[Category] " prefix the LM_LOG_CAT_* and LM_LOG_FAST_* macros add.
+        // Key/value fields are written logfmt-style after " | " at the end of the message, so text sinks
+        // stay readable:  LM_LOG_CAT_INFO(Renderer, "Swapchain recreated | width={} height={}", w, h);
+        // Numbers and true/false become JSON values, anything else a string; quote values containing
+        // spaces (path="C:/My Games"). A suffix that does not parse is left in "msg".
+        //
+        // When the file reaches MaxFileSizeBytes it is renamed to <stem>.<sequence>.jsonl and a new file is
+        // started; that single rename is the only rotation work done on the logging thread. Compression to
+        // .jsonl.gz and deletion of files beyond MaxRotatedFiles happen on a low-priority background thread.
+        class JsonLinesSink final : public spdlog::sinks::base_sink<std::mutex>
+        {
+        public:
+            struct Config
+            {
+                std::filesystem::path File;                 // Active file, e.g. Logs/Game_2026-01-02.jsonl
+                size_t MaxFileSizeBytes = 10 * 1024 * 1024;
+                size_t MaxRotatedFiles = 5;                 // Rotated files kept next to the active one
+                bool CompressRotated = true;
+            };
+
+            explicit JsonLinesSink(const Config& config);
+            ~JsonLinesSink() override;
+
+            // Block until every rotated file handed to the background thread has been processed
+            void WaitForMaintenance();
+
+            // Append msg as one JSON line (with the trailing newline)
+            static void FormatRecord(const spdlog::details::log_msg& msg, spdlog::memory_buf_t& out);
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override;
+            void flush_() override;
+
+        private:
+            class Maintenance;
+
+            void Rotate();
+
+            Config m_Config;
+            spdlog::details::file_helper m_File;
+            spdlog::memory_buf_t m_Buffer;
+            size_t m_CurrentSize = 0;
+            uint64_t m_NextSequence = 1;
+            std::unique_ptr<Maintenance> m_Maintenance;
+        };
+    }
+}
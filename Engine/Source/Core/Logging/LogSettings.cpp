@@ -0,0 +1,227 @@
+#include "lmpch.h"
+#include "Core/Logging/LogSettings.h"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        namespace
+        {
+            using Json = nlohmann::json;
+
+            bool ReadLevel(const Json& value, std::string_view key, std::optional<LogLevel>& level, std::string& error)
+            {
+                if (value.is_string())
+                {
+                    level = ParseLogLevel(value.get_ref<const std::string&>());
+                    if (level)
+                        return true;
+                }
+                error = "'" + std::string(key) + "' must be one of trace, debug, info, warn, error, critical, off";
+                return false;
+            }
+
+            bool ReadLogger(const Json& value, std::string_view key, LogSettings::Logger& logger, std::string& error)
+            {
+                if (!value.is_object())
+                {
+                    error = "'" + std::string(key) + "' must be an object";
+                    return false;
+                }
+                for (const auto& [name, field] : value.items())
+                {
+                    if (name == "level")
+                    {
+                        if (!ReadLevel(field, std::string(key) + ".level", logger.Level, error))
+                            return false;
+                    }
+                    else if (name == "sinks")
+                    {
+                        if (!field.is_array())
+                        {
+                            error = "'" + std::string(key) + ".sinks' must be an array of sink names";
+                            return false;
+                        }
+                        auto& sinks = logger.Sinks.emplace();
+                        for (const auto& sink : field)
+                        {
+                            if (!sink.is_string())
+                            {
+                                error = "'" + std::string(key) + ".sinks' must be an array of sink names";
+                                return false;
+                            }
+                            sinks.push_back(sink.get<std::string>());
+                        }
+                    }
+                    else
+                    {
+                        error = "unknown key '" + std::string(key) + "." + name + "'";
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ReadSink(const Json& value, const std::string& key, LogSettings::Sink& sink, std::string& error)
+            {
+                if (!value.is_object())
+                {
+                    error = "'" + key + "' must be an object";
+                    return false;
+                }
+                for (const auto& [name, field] : value.items())
+                {
+                    if (name == "level")
+                    {
+                        if (!ReadLevel(field, key + ".level", sink.Level, error))
+                            return false;
+                    }
+                    else if (name == "pattern" && field.is_string())
+                    {
+                        sink.Pattern = field.get<std::string>();
+                    }
+                    else
+                    {
+                        error = name == "pattern" ? "'" + key + ".pattern' must be a string" : "unknown key '" + key + "." + name + "'";
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ReadCategories(const Json& value, LogSettings& settings, std::string& error)
+            {
+                if (!value.is_object())
+                {
+                    error = "'categories' must be an object";
+                    return false;
+                }
+                for (const auto& [name, field] : value.items())
+                {
+                    std::optional<LogLevel>* target = name == "*" ? &settings.DefaultCategoryLevel : nullptr;
+                    for (size_t i = 0; !target && i < settings.Categories.size(); ++i)
+                    {
+                        if (name == ToString(static_cast<LogCategory>(i)))
+                            target = &settings.Categories[i];
+                    }
+                    if (!target)
+                    {
+                        error = "unknown category '" + name + "'";
+                        return false;
+                    }
+                    if (!ReadLevel(field, "categories." + name, *target, error))
+                        return false;
+                }
+                return true;
+            }
+        }
+
+        std::optional<LogLevel> ParseLogLevel(std::string_view name)
+        {
+            if (name == "trace")                        return LogLevel::Trace;
+            if (name == "debug")                        return LogLevel::Debug;
+            if (name == "info")                         return LogLevel::Info;
+            if (name == "warn" || name == "warning")    return LogLevel::Warn;
+            if (name == "error" || name == "err")       return LogLevel::Error;
+            if (name == "critical")                     return LogLevel::Critical;
+            if (name == "off")                          return LogLevel::Off;
+            return std::nullopt;
+        }
+
+        bool ParseLogSettings(std::string_view json, LogSettings& settings, std::string& error)
+        {
+            Json document;
+            try
+            {
+                document = Json::parse(json.begin(), json.end());
+            }
+            catch (const Json::parse_error& e)
+            {
+                error = e.what();
+                return false;
+            }
+            if (!document.is_object())
+            {
+                error = "the document must be an object";
+                return false;
+            }
+
+            LogSettings parsed;
+            for (const auto& [key, value] : document.items())
+            {
+                bool valid = true;
+                if (key == "level")
+                {
+                    valid = ReadLevel(value, key, parsed.Level, error);
+                }
+                else if (key == "suppress_duplicates")
+                {
+                    valid = value.is_boolean();
+                    if (valid)
+                        parsed.SuppressDuplicates = value.get<bool>();
+                    else
+                        error = "'suppress_duplicates' must be true or false";
+                }
+                else if (key == "loggers")
+                {
+                    valid = value.is_object();
+                    if (!valid)
+                        error = "'loggers' must be an object";
+                    for (auto it = value.begin(); valid && it != value.end(); ++it)
+                    {
+                        if (it.key() == "core")
+                            valid = ReadLogger(it.value(), "loggers.core", parsed.Core, error);
+                        else if (it.key() == "client")
+                            valid = ReadLogger(it.value(), "loggers.client", parsed.Client, error);
+                        else
+                        {
+                            error = "unknown logger '" + it.key() + "' (expected core or client)";
+                            valid = false;
+                        }
+                    }
+                }
+                else if (key == "categories")
+                {
+                    valid = ReadCategories(value, parsed, error);
+                }
+                else if (key == "sinks")
+                {
+                    valid = value.is_object();
+                    if (!valid)
+                        error = "'sinks' must be an object";
+                    for (auto it = value.begin(); valid && it != value.end(); ++it)
+                        valid = ReadSink(it.value(), "sinks." + it.key(), parsed.Sinks[it.key()], error);
+                }
+                else
+                {
+                    error = "unknown key '" + key + "'";
+                    valid = false;
+                }
+
+                if (!valid)
+                    return false;
+            }
+
+            settings = std::move(parsed);
+            return true;
+        }
+
+        bool LoadLogSettings(const std::filesystem::path& file, LogSettings& settings, std::string& error)
+        {
+            std::ifstream input(file, std::ios::binary);
+            if (!input)
+            {
+                error = "cannot open '" + file.string() + "'";
+                return false;
+            }
+            std::ostringstream contents;
+            contents << input.rdbuf();
+            return ParseLogSettings(contents.str(), settings, error);
+        }
+    }
+}
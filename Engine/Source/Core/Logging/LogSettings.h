@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <array>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Limitless
+{
+    namespace Logging
+    {
+        // Runtime overrides read from LogConfig::SettingsFile (logging.json by default). Log polls the file
+        // and re-applies it whenever it changes; every key is optional and anything left out returns to what
+        // Log::Init set up, so deleting the file undoes all overrides. For example, to trace the renderer
+        // on a running release build:
+        //
+        //     {
+        //         "level": "info",
+        //         "suppress_duplicates": true,
+        //         "loggers": {
+        //             "core":   { "level": "trace", "sinks": ["file"] },
+        //             "client": { "level": "warn" }
+        //         },
+        //         "categories": { "*": "info", "Renderer": "trace" },
+        //         "sinks": {
+        //             "console": { "level": "warn", "pattern": "[%T] [%^%l%$] %v" },
+        //             "file":    { "pattern": "[%Y-%m-%d %T.%f] [%l] [%n] [%t] %v" }
+        //         }
+        //     }
+        //
+        // Levels are trace, debug, info, warn, error, critical or off. Loggers are "core" and "client";
+        // their "sinks" list picks which of Init's sinks ("console", "file" and, when enabled, "flight")
+        // they write to. Patterns belong to sinks because spdlog formats in the sink, which both loggers
+        // share. "*" sets the level of categories not listed. Category macros are compiled in up to
+        // LM_LOG_CATEGORY_ACTIVE_LEVEL regardless of SPDLOG_ACTIVE_LEVEL, so they can be raised at runtime.
+        struct LogSettings
+        {
+            struct Logger
+            {
+                std::optional<LogLevel> Level;
+                std::optional<std::vector<std::string>> Sinks;
+            };
+
+            struct Sink
+            {
+                std::optional<LogLevel> Level;
+                std::optional<std::string> Pattern;
+            };
+
+            std::optional<LogLevel> Level;
+            std::optional<bool> SuppressDuplicates;
+            Logger Core;
+            Logger Client;
+            std::optional<LogLevel> DefaultCategoryLevel;
+            std::array<std::optional<LogLevel>, static_cast<size_t>(LogCategory::Count)> Categories{};
+            std::map<std::string, Sink, std::less<>> Sinks;
+        };
+
+        std::optional<LogLevel> ParseLogLevel(std::string_view name);
+
+        // Parse a settings document. Unknown keys, levels and categories are errors so that a typo is
+        // reported instead of silently ignored; on failure settings is left untouched.
+        bool ParseLogSettings(std::string_view json, LogSettings& settings, std::string& error);
+        bool LoadLogSettings(const std::filesystem::path& file, LogSettings& settings, std::string& error);
+    }
+}
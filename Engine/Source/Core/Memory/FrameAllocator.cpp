@@ -0,0 +1,173 @@
+#include "lmpch.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Log.h"
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        namespace
+        {
+            constexpr size_t MinPageSize = 64 * 1024;
+            constexpr size_t BlockAlignment = 64;
+
+            std::byte* AlignPointer(std::byte* pointer, size_t alignment) noexcept
+            {
+                auto address = reinterpret_cast<uintptr_t>(pointer);
+                return pointer + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+            }
+        }
+
+        FrameAllocator& FrameAllocator::Get()
+        {
+            static FrameAllocator instance;
+            return instance;
+        }
+
+        void FrameAllocator::Configure(size_t arenaSize, uint32_t bufferCount)
+        {
+            LM_ASSERT_MSG(!m_InUse.load(std::memory_order_relaxed), "FrameAllocator configured after it was used");
+            LM_ASSERT_MSG(bufferCount >= 2 && bufferCount <= MaxBufferCount, "FrameAllocator needs 2 or 3 buffers");
+            m_ArenaSize = arenaSize;
+            m_BufferCount = bufferCount;
+        }
+
+        void FrameAllocator::BeginFrame()
+        {
+            const uint64_t ending = m_FrameNumber.load(std::memory_order_relaxed);
+
+            // Usage of the frame that just ended, from every arena that took part in it
+            size_t bytes = 0;
+            for (Arena& arena : m_Buffers[ending % m_BufferCount].Arenas)
+            {
+                if (arena.Frame.load(std::memory_order_relaxed) == ending)
+                    bytes += arena.Used.load(std::memory_order_relaxed);
+            }
+            const uint64_t pages = m_OverflowPages.load(std::memory_order_relaxed);
+
+            m_Stats.LastFrameBytes = bytes;
+            m_Stats.HighWater = std::max(m_Stats.HighWater, bytes);
+            m_Stats.LastFrameOverflowPages = pages - m_Stats.OverflowPages;
+            m_Stats.OverflowPages = pages;
+
+            // Arenas reset themselves lazily when their owner next allocates, so rotating is a single store
+            m_FrameNumber.store(ending + 1, std::memory_order_release);
+        }
+
+        void FrameAllocator::ReleaseMemory()
+        {
+            for (uint32_t i = 0; i < MaxBufferCount; ++i)
+            {
+                for (Arena& arena : m_Buffers[i].Arenas)
+                {
+                    FreePages(arena);
+                    if (arena.Base)
+                        ::operator delete(arena.Base, std::align_val_t(BlockAlignment));
+                    arena.Base = nullptr;
+                    arena.Capacity = 0;
+                    arena.Offset = 0;
+                    arena.Frame.store(0, std::memory_order_relaxed);
+                    arena.Used.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void* FrameAllocator::Allocate(size_t size, size_t alignment)
+        {
+            LM_ASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2");
+            if (!m_InUse.load(std::memory_order_relaxed))
+                m_InUse.store(true, std::memory_order_relaxed);
+
+            const uint64_t frame = m_FrameNumber.load(std::memory_order_acquire);
+            Buffer& buffer = m_Buffers[frame % m_BufferCount];
+
+            const uint32_t index = Concurrency::ThreadIndex::Get();
+            if (index == Concurrency::ThreadIndex::InvalidIndex)
+            {
+                std::scoped_lock lock(m_SharedMutex);
+                return AllocateFrom(buffer.Arenas[Concurrency::ThreadIndex::MaxThreads], frame, size, alignment);
+            }
+            return AllocateFrom(buffer.Arenas[index], frame, size, alignment);
+        }
+
+        void* FrameAllocator::AllocateFrom(Arena& arena, uint64_t frame, size_t size, size_t alignment)
+        {
+            if (arena.Frame.load(std::memory_order_relaxed) != frame)
+                Reset(arena, frame);
+
+            std::byte* start = AlignPointer(arena.Base + arena.Offset, alignment);
+            const size_t end = static_cast<size_t>(start - arena.Base) + size;
+            if (arena.Overflow || end > arena.Capacity)
+                return AllocateOverflow(arena, size, alignment);
+
+            arena.Offset = end;
+            arena.Used.store(arena.Offset + arena.OverflowBytes, std::memory_order_relaxed);
+            return start;
+        }
+
+        void* FrameAllocator::AllocateOverflow(Arena& arena, size_t size, size_t alignment)
+        {
+            Page* page = arena.Overflow;
+            std::byte* start = nullptr;
+            if (page)
+            {
+                std::byte* data = reinterpret_cast<std::byte*>(page + 1);
+                start = AlignPointer(data + page->Offset, alignment);
+                if (static_cast<size_t>(start - data) + size > page->Capacity)
+                    start = nullptr;
+            }
+
+            if (!start)
+            {
+                const size_t capacity = std::max(MinPageSize, size + alignment);
+                void* memory = ::operator new(sizeof(Page) + capacity, std::align_val_t(BlockAlignment));
+                page = new (memory) Page{ arena.Overflow, capacity, 0 };
+                arena.Overflow = page;
+                m_OverflowPages.fetch_add(1, std::memory_order_relaxed);
+                start = AlignPointer(reinterpret_cast<std::byte*>(page + 1), alignment);
+            }
+
+            std::byte* data = reinterpret_cast<std::byte*>(page + 1);
+            const size_t end = static_cast<size_t>(start - data) + size;
+            arena.OverflowBytes += end - page->Offset;
+            page->Offset = end;
+            arena.Used.store(arena.Offset + arena.OverflowBytes, std::memory_order_relaxed);
+            return start;
+        }
+
+        void FrameAllocator::Reset(Arena& arena, uint64_t frame)
+        {
+            // Grow to cover the last peak so a frame that overflowed once fits in the arena from now on
+            size_t wanted = std::max(arena.Capacity, m_ArenaSize);
+            if (arena.OverflowBytes != 0)
+                wanted = std::max(wanted, arena.Offset + arena.OverflowBytes + arena.OverflowBytes / 2);
+
+            FreePages(arena);
+            if (!arena.Base || wanted > arena.Capacity)
+            {
+                if (arena.Base)
+                    ::operator delete(arena.Base, std::align_val_t(BlockAlignment));
+                arena.Base = static_cast<std::byte*>(::operator new(wanted, std::align_val_t(BlockAlignment)));
+                arena.Capacity = wanted;
+            }
+
+            arena.Offset = 0;
+            arena.Frame.store(frame, std::memory_order_relaxed);
+            arena.Used.store(0, std::memory_order_relaxed);
+        }
+
+        void FrameAllocator::FreePages(Arena& arena) noexcept
+        {
+            Page* page = arena.Overflow;
+            while (page)
+            {
+                Page* next = page->Next;
+                page->~Page();
+                ::operator delete(page, std::align_val_t(BlockAlignment));
+                page = next;
+            }
+            arena.Overflow = nullptr;
+            arena.OverflowBytes = 0;
+        }
+    }
+}
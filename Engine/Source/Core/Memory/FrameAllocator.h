@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Core/Concurrency/ThreadIndex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        // Per-frame scratch memory. Allocation is a pointer bump; nothing is freed individually and no
+        // destructors run. Every thread bumps its own sub-arena, so workers never contend.
+        // There are BufferCount sets of arenas used round-robin: memory allocated in frame N stays valid
+        // through frame N + BufferCount - 1 (so the next frame can still read it), and is reclaimed
+        // wholesale when its set comes round again. Application::Run calls BeginFrame at the top of
+        // every iteration.
+        //
+        // A frame that outgrows an arena continues in heap-allocated overflow pages; the next time that
+        // arena is reset it grows to cover the peak, so overflow is a one-off rather than a steady cost.
+        class FrameAllocator
+        {
+        public:
+            static constexpr size_t DefaultArenaSize = 256 * 1024;
+            static constexpr uint32_t MaxBufferCount = 3;
+
+            struct Stats
+            {
+                size_t LastFrameBytes = 0;     // Bytes handed out during the previous frame, all threads
+                size_t HighWater = 0;          // Largest LastFrameBytes seen
+                uint64_t LastFrameOverflowPages = 0; // Overflow pages allocated during the previous frame
+                uint64_t OverflowPages = 0;          // Overflow pages allocated since startup
+            };
+
+            static FrameAllocator& Get();
+
+            // Size of each thread's arena and number of rotating buffers (2 or 3).
+            // Must be called before the first allocation.
+            void Configure(size_t arenaSize, uint32_t bufferCount = 2);
+
+            // Rotate to the next buffer (main thread, once per frame)
+            void BeginFrame();
+
+            // Return every arena to the system (at shutdown, when no other thread is allocating)
+            void ReleaseMemory();
+
+            // Bump-allocate size bytes valid until this buffer comes round again. Never returns nullptr.
+            void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+            template<typename T, typename... Args>
+            T* New(Args&&... args)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "Frame memory is reset without running destructors");
+                return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            }
+
+            template<typename T>
+            std::span<T> NewArray(size_t count)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "Frame memory is reset without running destructors");
+                T* data = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+                std::uninitialized_default_construct_n(data, count);
+                return { data, count };
+            }
+
+            // Adapter for std::pmr containers whose contents only live for the frame. Deallocation is a no-op.
+            std::pmr::memory_resource* GetResource() noexcept { return &m_Resource; }
+
+            uint64_t GetFrameNumber() const noexcept { return m_FrameNumber.load(std::memory_order_acquire); }
+            uint32_t GetBufferCount() const noexcept { return m_BufferCount; }
+            size_t GetArenaSize() const noexcept { return m_ArenaSize; }
+            Stats GetStats() const noexcept { return m_Stats; }
+
+        private:
+            struct Page
+            {
+                Page* Next;
+                size_t Capacity;
+                size_t Offset;
+            };
+
+            struct alignas(64) Arena
+            {
+                std::byte* Base = nullptr;
+                size_t Capacity = 0;
+                size_t Offset = 0;
+                std::atomic<uint64_t> Frame{ 0 }; // Frame the arena was last reset for
+                Page* Overflow = nullptr;         // Most recent page first
+                size_t OverflowBytes = 0;
+                std::atomic<size_t> Used{ 0 };    // Written by the owner, summed by BeginFrame
+            };
+
+            // One arena per ThreadIndex plus a mutex-guarded one for threads without an index
+            struct Buffer
+            {
+                Arena Arenas[Concurrency::ThreadIndex::MaxThreads + 1];
+            };
+
+            class Resource : public std::pmr::memory_resource
+            {
+            public:
+                explicit Resource(FrameAllocator& owner) : m_Owner(owner) {}
+
+            private:
+                void* do_allocate(size_t bytes, size_t alignment) override { return m_Owner.Allocate(bytes, alignment); }
+                void do_deallocate(void*, size_t, size_t) override {}
+                bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+                FrameAllocator& m_Owner;
+            };
+
+            FrameAllocator() = default;
+            FrameAllocator(const FrameAllocator&) = delete;
+            FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+            void* AllocateFrom(Arena& arena, uint64_t frame, size_t size, size_t alignment);
+            void* AllocateOverflow(Arena& arena, size_t size, size_t alignment);
+            void Reset(Arena& arena, uint64_t frame);
+            static void FreePages(Arena& arena) noexcept;
+
+        private:
+            size_t m_ArenaSize = DefaultArenaSize;
+            uint32_t m_BufferCount = 2;
+            std::atomic<bool> m_InUse{ false };
+
+            std::atomic<uint64_t> m_FrameNumber{ 1 };
+            std::unique_ptr<Buffer[]> m_Buffers = std::make_unique<Buffer[]>(MaxBufferCount);
+            std::mutex m_SharedMutex;
+            std::atomic<uint64_t> m_OverflowPages{ 0 };
+            Stats m_Stats;
+            Resource m_Resource{ *this };
+        };
+    }
+}
@@ -0,0 +1,279 @@
+#include "lmpch.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Log.h"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        namespace
+        {
+            constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+            constexpr const char* TagNames[TagCount] = {
+                "Untagged", "Core", "Renderer", "Logging", "Assets", "Gameplay", "Audio", "Jobs"
+            };
+
+            // Constant-initialized so operator new can use them before any dynamic initialization has run
+            struct alignas(64) TagCounters
+            {
+                std::atomic<size_t> LiveBytes{ 0 };
+                std::atomic<size_t> LiveAllocations{ 0 };
+                std::atomic<size_t> PeakBytes{ 0 };
+                std::atomic<uint64_t> TotalAllocations{ 0 };
+                std::atomic<uint64_t> FrameAllocations{ 0 };
+                std::atomic<uint64_t> LastFrameAllocations{ 0 };
+                std::atomic<size_t> Budget{ 0 };
+                std::atomic<bool> OverBudget{ false };   // Already reported; cleared once back under budget
+            };
+
+            TagCounters s_Counters[TagCount];
+            thread_local MemoryTag t_CurrentTag = MemoryTag::Untagged;
+
+            TagCounters& CountersFor(MemoryTag tag) noexcept
+            {
+                size_t index = static_cast<size_t>(tag);
+                return s_Counters[index < TagCount ? index : 0];
+            }
+
+            double ToMiB(size_t bytes) noexcept
+            {
+                return static_cast<double>(bytes) / (1024.0 * 1024.0);
+            }
+        }
+
+        const char* ToString(MemoryTag tag) noexcept
+        {
+            size_t index = static_cast<size_t>(tag);
+            return index < TagCount ? TagNames[index] : "Unknown";
+        }
+
+        MemoryTag MemoryTracker::GetCurrentTag() noexcept
+        {
+            return t_CurrentTag;
+        }
+
+        MemoryTag MemoryTracker::SetCurrentTag(MemoryTag tag) noexcept
+        {
+            MemoryTag previous = t_CurrentTag;
+            t_CurrentTag = tag;
+            return previous;
+        }
+
+        void MemoryTracker::RecordAllocation(MemoryTag tag, size_t bytes) noexcept
+        {
+            TagCounters& counters = CountersFor(tag);
+            size_t live = counters.LiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+
+            size_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void MemoryTracker::RecordFree(MemoryTag tag, size_t bytes) noexcept
+        {
+            TagCounters& counters = CountersFor(tag);
+            counters.LiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void MemoryTracker::SetBudget(MemoryTag tag, size_t bytes) noexcept
+        {
+            TagCounters& counters = CountersFor(tag);
+            counters.Budget.store(bytes, std::memory_order_relaxed);
+            counters.OverBudget.store(false, std::memory_order_relaxed);
+        }
+
+        MemoryTracker::TagStats MemoryTracker::GetStats(MemoryTag tag) noexcept
+        {
+            const TagCounters& counters = CountersFor(tag);
+            TagStats stats;
+            stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+            stats.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+            stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+            stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+            stats.FrameAllocations = counters.LastFrameAllocations.load(std::memory_order_relaxed);
+            stats.Budget = counters.Budget.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        void MemoryTracker::BeginFrame()
+        {
+            for (size_t i = 0; i < TagCount; ++i)
+            {
+                TagCounters& counters = s_Counters[i];
+                counters.LastFrameAllocations.store(counters.FrameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+
+                const size_t budget = counters.Budget.load(std::memory_order_relaxed);
+                if (budget == 0)
+                    continue;
+
+                const size_t live = counters.LiveBytes.load(std::memory_order_relaxed);
+                if (live > budget)
+                {
+                    if (!counters.OverBudget.exchange(true, std::memory_order_relaxed))
+                    {
+                        LM_LOG_CAT_WARN(Memory, "Memory budget exceeded for {}: {:.2f} MiB live, budget {:.2f} MiB (peak {:.2f} MiB)",
+                            TagNames[i], ToMiB(live), ToMiB(budget), ToMiB(counters.PeakBytes.load(std::memory_order_relaxed)));
+                    }
+                }
+                else
+                {
+                    counters.OverBudget.store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        nlohmann::json MemoryTracker::Snapshot()
+        {
+            nlohmann::json tags = nlohmann::json::object();
+            TagStats total;
+            for (size_t i = 0; i < TagCount; ++i)
+            {
+                TagStats stats = GetStats(static_cast<MemoryTag>(i));
+                tags[TagNames[i]] = {
+                    { "live_bytes", stats.LiveBytes },
+                    { "live_allocations", stats.LiveAllocations },
+                    { "peak_bytes", stats.PeakBytes },
+                    { "total_allocations", stats.TotalAllocations },
+                    { "frame_allocations", stats.FrameAllocations },
+                    { "budget_bytes", stats.Budget }
+                };
+                total.LiveBytes += stats.LiveBytes;
+                total.LiveAllocations += stats.LiveAllocations;
+                total.TotalAllocations += stats.TotalAllocations;
+                total.FrameAllocations += stats.FrameAllocations;
+            }
+
+            return {
+                { "global_override", IsGlobalOverrideEnabled() },
+                { "tags", std::move(tags) },
+                { "total", {
+                    { "live_bytes", total.LiveBytes },
+                    { "live_allocations", total.LiveAllocations },
+                    { "total_allocations", total.TotalAllocations },
+                    { "frame_allocations", total.FrameAllocations }
+                } }
+            };
+        }
+
+        void MemoryTracker::SaveSnapshot(const std::filesystem::path& path)
+        {
+            std::ofstream file(path);
+            if (!file)
+            {
+                LM_LOG_CAT_ERROR(Memory, "Failed to open '{}' for the memory snapshot", path.string());
+                return;
+            }
+            file << Snapshot().dump(2);
+        }
+
+        bool MemoryTracker::IsGlobalOverrideEnabled() noexcept
+        {
+#if defined(LM_MEMORY_TRACKING)
+            return true;
+#else
+            return false;
+#endif
+        }
+    }
+}
+
+#if defined(LM_MEMORY_TRACKING)
+
+// Global operator new/delete replacement. Every block carries a 16-byte header just below the pointer handed
+// out, recording the requested size, the tag it was charged to and the distance back to the malloc'd block.
+namespace
+{
+    struct AllocationHeader
+    {
+        uint64_t Size;
+        uint32_t Offset;
+        uint8_t Tag;
+        uint8_t Padding[3];
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    void* TrackedAllocate(size_t size, size_t alignment) noexcept
+    {
+        using namespace Limitless::Memory;
+
+        if (alignment < alignof(AllocationHeader) * 2)
+            alignment = alignof(AllocationHeader) * 2;
+
+        void* raw = std::malloc(size + sizeof(AllocationHeader) + alignment - 1);
+        if (!raw)
+            return nullptr;
+
+        uintptr_t address = reinterpret_cast<uintptr_t>(raw) + sizeof(AllocationHeader);
+        address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+        MemoryTag tag = MemoryTracker::GetCurrentTag();
+        auto* header = reinterpret_cast<AllocationHeader*>(address) - 1;
+        header->Size = size;
+        header->Offset = static_cast<uint32_t>(address - reinterpret_cast<uintptr_t>(raw));
+        header->Tag = static_cast<uint8_t>(tag);
+
+        MemoryTracker::RecordAllocation(tag, size);
+        return reinterpret_cast<void*>(address);
+    }
+
+    void TrackedFree(void* pointer) noexcept
+    {
+        using namespace Limitless::Memory;
+
+        if (!pointer)
+            return;
+        auto* header = static_cast<AllocationHeader*>(pointer) - 1;
+        MemoryTracker::RecordFree(static_cast<MemoryTag>(header->Tag), static_cast<size_t>(header->Size));
+        std::free(static_cast<std::byte*>(pointer) - header->Offset);
+    }
+
+    void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+    {
+        for (;;)
+        {
+            if (void* pointer = TrackedAllocate(size, alignment))
+                return pointer;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t size) { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size) { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+
+#endif
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        // Subsystem an allocation is charged to
+        enum class MemoryTag : uint8_t
+        {
+            Untagged = 0,
+            Core,
+            Renderer,
+            Logging,
+            Assets,
+            Gameplay,
+            Audio,
+            Jobs,
+            Count
+        };
+
+        const char* ToString(MemoryTag tag) noexcept;
+
+        // Per-tag allocation accounting. With LM_MEMORY_TRACKING defined (Debug builds, or Release generated
+        // with premake5 --memory-tracking) the engine replaces the global operator new/delete and charges every
+        // heap allocation to the calling thread's current tag; without it, allocators and subsystems can still report through RecordAllocation/RecordFree.
+        // Counters are relaxed atomics, so reads are approximate while other threads allocate.
+        class MemoryTracker
+        {
+        public:
+            struct TagStats
+            {
+                size_t LiveBytes = 0;
+                size_t LiveAllocations = 0;
+                size_t PeakBytes = 0;
+                uint64_t TotalAllocations = 0;
+                uint64_t FrameAllocations = 0;     // Allocations during the last completed frame
+                size_t Budget = 0;                 // 0 when no budget is set
+            };
+
+            // Tag new allocations on this thread are charged to (see LM_MEMTAG)
+            static MemoryTag GetCurrentTag() noexcept;
+            static MemoryTag SetCurrentTag(MemoryTag tag) noexcept; // Returns the previous tag
+
+            static void RecordAllocation(MemoryTag tag, size_t bytes) noexcept;
+            static void RecordFree(MemoryTag tag, size_t bytes) noexcept;
+
+            // Warn when a tag's live bytes exceed budget (0 disables). Checked once per frame.
+            static void SetBudget(MemoryTag tag, size_t bytes) noexcept;
+
+            static TagStats GetStats(MemoryTag tag) noexcept;
+
+            // Close the per-frame allocation counts and report budgets exceeded since the last call.
+            // Application::Run calls this once per frame; warnings are never logged from inside operator new.
+            static void BeginFrame();
+
+            // Every tag's counters plus totals, as JSON
+            static nlohmann::json Snapshot();
+            static void SaveSnapshot(const std::filesystem::path& path);
+
+            // Whether this build replaced the global operator new/delete
+            static bool IsGlobalOverrideEnabled() noexcept;
+        };
+
+        // Charges allocations made on this thread to tag until the scope ends
+        class MemoryTagScope
+        {
+        public:
+            explicit MemoryTagScope(MemoryTag tag) noexcept : m_Previous(MemoryTracker::SetCurrentTag(tag)) {}
+            ~MemoryTagScope() { MemoryTracker::SetCurrentTag(m_Previous); }
+
+            MemoryTagScope(const MemoryTagScope&) = delete;
+            MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+        private:
+            MemoryTag m_Previous;
+        };
+    }
+}
+
+#define LM_MEMTAG_CONCAT_INNER(a, b) a##b
+#define LM_MEMTAG_CONCAT(a, b) LM_MEMTAG_CONCAT_INNER(a, b)
+
+// Charge allocations in the enclosing scope to a subsystem: LM_MEMTAG(Renderer);
+#define LM_MEMTAG(tag) ::Limitless::Memory::MemoryTagScope LM_MEMTAG_CONCAT(lmMemTagScope, __LINE__)(::Limitless::Memory::MemoryTag::tag)
@@ -0,0 +1,362 @@
+#include "lmpch.h"
+#include "Core/Memory/TLSFResource.h"
+#include "Core/Log.h"
+
+#include <bit>
+#include <new>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        namespace
+        {
+            constexpr size_t HeaderSize = 2 * sizeof(void*);
+            constexpr size_t MinBlockSize = 2 * sizeof(void*);
+
+            constexpr size_t AlignUp(size_t value, size_t alignment) noexcept
+            {
+                return (value + alignment - 1) & ~(alignment - 1);
+            }
+        }
+
+        // Every block starts with this header; the payload follows it. Free blocks keep their free-list links
+        // in the first bytes of the payload, which is why a payload is never smaller than two pointers.
+        struct TLSFResource::Block
+        {
+            static constexpr size_t FreeFlag = 1;
+
+            Block* PrevPhysical;   // nullptr for the first block of a pool
+            size_t SizeAndFlags;   // Payload size (a multiple of Alignment) | FreeFlag
+            Block* NextFree;
+            Block* PrevFree;
+
+            size_t GetSize() const noexcept { return SizeAndFlags & ~FreeFlag; }
+            void SetSize(size_t size) noexcept { SizeAndFlags = size | (SizeAndFlags & FreeFlag); }
+            bool IsFree() const noexcept { return (SizeAndFlags & FreeFlag) != 0; }
+            void SetFree(bool free) noexcept { SizeAndFlags = free ? (SizeAndFlags | FreeFlag) : (SizeAndFlags & ~FreeFlag); }
+
+            std::byte* GetPayload() noexcept { return reinterpret_cast<std::byte*>(this) + HeaderSize; }
+            Block* GetNextPhysical() noexcept { return reinterpret_cast<Block*>(GetPayload() + GetSize()); }
+
+            static Block* FromPayload(void* payload) noexcept
+            {
+                return reinterpret_cast<Block*>(static_cast<std::byte*>(payload) - HeaderSize);
+            }
+        };
+
+        // Header at the start of every chunk obtained from upstream. The pool's blocks follow it and end with
+        // a zero-sized, permanently used sentinel so coalescing never walks off the end.
+        struct TLSFResource::Pool
+        {
+            Pool* Next;
+            size_t Bytes;
+        };
+
+        TLSFResource::TLSFResource(size_t poolSize, bool synchronized, std::pmr::memory_resource* upstream)
+            : m_Upstream(upstream)
+            , m_PoolSize(poolSize)
+            , m_Synchronized(synchronized)
+        {
+            static_assert(HeaderSize % Alignment == 0 && sizeof(Pool) % Alignment == 0);
+            LM_ASSERT_MSG(m_Upstream != nullptr, "TLSFResource needs an upstream resource");
+        }
+
+        TLSFResource::~TLSFResource()
+        {
+            LM_ASSERT_MSG(m_Stats.Allocations == 0, "TLSFResource destroyed with {} live allocations", m_Stats.Allocations);
+
+            Pool* pool = m_Pools;
+            while (pool)
+            {
+                Pool* next = pool->Next;
+                m_Upstream->deallocate(pool, pool->Bytes, Alignment);
+                pool = next;
+            }
+        }
+
+        TLSFResource::Stats TLSFResource::GetStats() const
+        {
+            std::unique_lock lock(m_Mutex, std::defer_lock);
+            if (m_Synchronized)
+                lock.lock();
+            return m_Stats;
+        }
+
+        void* TLSFResource::do_allocate(size_t bytes, size_t alignment)
+        {
+            std::unique_lock lock(m_Mutex, std::defer_lock);
+            if (m_Synchronized)
+                lock.lock();
+            return Allocate(bytes, alignment);
+        }
+
+        void TLSFResource::do_deallocate(void* pointer, size_t, size_t)
+        {
+            std::unique_lock lock(m_Mutex, std::defer_lock);
+            if (m_Synchronized)
+                lock.lock();
+            Deallocate(pointer);
+        }
+
+        void TLSFResource::MappingInsert(size_t size, uint32_t& firstLevel, uint32_t& secondLevel) noexcept
+        {
+            if (size < SmallBlockSize)
+            {
+                // Small sizes are spread linearly over the first row
+                firstLevel = 0;
+                secondLevel = static_cast<uint32_t>(size / (SmallBlockSize / SecondLevelCount));
+            }
+            else
+            {
+                const uint32_t topBit = static_cast<uint32_t>(std::bit_width(size)) - 1;
+                secondLevel = static_cast<uint32_t>(size >> (topBit - SecondLevelLog2)) ^ SecondLevelCount;
+                firstLevel = topBit - (FirstLevelShift - 1);
+            }
+        }
+
+        void TLSFResource::MappingSearch(size_t size, uint32_t& firstLevel, uint32_t& secondLevel) noexcept
+        {
+            // Round up to the next second-level step so any block in the bin found is large enough
+            if (size >= SmallBlockSize)
+                size += (size_t(1) << (std::bit_width(size) - 1 - SecondLevelLog2)) - 1;
+            MappingInsert(size, firstLevel, secondLevel);
+        }
+
+        TLSFResource::Block* TLSFResource::FindFree(size_t size) noexcept
+        {
+            uint32_t firstLevel, secondLevel;
+            MappingSearch(size, firstLevel, secondLevel);
+            if (firstLevel >= FirstLevelCount)
+                return nullptr;
+
+            uint32_t secondMap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+            if (secondMap == 0)
+            {
+                const uint32_t firstMap = firstLevel + 1 < FirstLevelCount ? m_FirstLevelBitmap & (~0u << (firstLevel + 1)) : 0;
+                if (firstMap == 0)
+                    return nullptr;
+                firstLevel = static_cast<uint32_t>(std::countr_zero(firstMap));
+                secondMap = m_SecondLevelBitmaps[firstLevel];
+            }
+            secondLevel = static_cast<uint32_t>(std::countr_zero(secondMap));
+            return m_FreeLists[firstLevel][secondLevel];
+        }
+
+        void TLSFResource::InsertFree(Block* block) noexcept
+        {
+            uint32_t firstLevel, secondLevel;
+            MappingInsert(block->GetSize(), firstLevel, secondLevel);
+
+            Block* head = m_FreeLists[firstLevel][secondLevel];
+            block->NextFree = head;
+            block->PrevFree = nullptr;
+            if (head)
+                head->PrevFree = block;
+            m_FreeLists[firstLevel][secondLevel] = block;
+
+            m_FirstLevelBitmap |= 1u << firstLevel;
+            m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+            block->SetFree(true);
+        }
+
+        void TLSFResource::RemoveFree(Block* block) noexcept
+        {
+            uint32_t firstLevel, secondLevel;
+            MappingInsert(block->GetSize(), firstLevel, secondLevel);
+
+            if (block->PrevFree)
+                block->PrevFree->NextFree = block->NextFree;
+            else
+                m_FreeLists[firstLevel][secondLevel] = block->NextFree;
+            if (block->NextFree)
+                block->NextFree->PrevFree = block->PrevFree;
+
+            if (!m_FreeLists[firstLevel][secondLevel])
+            {
+                m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+                if (m_SecondLevelBitmaps[firstLevel] == 0)
+                    m_FirstLevelBitmap &= ~(1u << firstLevel);
+            }
+            block->SetFree(false);
+        }
+
+        TLSFResource::Block* TLSFResource::Split(Block* block, size_t size) noexcept
+        {
+            const size_t available = block->GetSize();
+            if (available < size + HeaderSize + MinBlockSize)
+                return nullptr;
+
+            auto* rest = reinterpret_cast<Block*>(block->GetPayload() + size);
+            rest->PrevPhysical = block;
+            rest->SizeAndFlags = available - size - HeaderSize;
+            rest->GetNextPhysical()->PrevPhysical = rest;
+            block->SetSize(size);
+            return rest;
+        }
+
+        TLSFResource::Block* TLSFResource::Coalesce(Block* block) noexcept
+        {
+            Block* previous = block->PrevPhysical;
+            if (previous && previous->IsFree())
+            {
+                RemoveFree(previous);
+                previous->SetSize(previous->GetSize() + HeaderSize + block->GetSize());
+                previous->GetNextPhysical()->PrevPhysical = previous;
+                block = previous;
+            }
+
+            Block* next = block->GetNextPhysical();
+            if (next->IsFree())
+            {
+                RemoveFree(next);
+                block->SetSize(block->GetSize() + HeaderSize + next->GetSize());
+                block->GetNextPhysical()->PrevPhysical = block;
+            }
+            return block;
+        }
+
+        bool TLSFResource::AddPool(size_t minimumBlockSize)
+        {
+            // Pool header, one block header and the sentinel header around the payload
+            const size_t overhead = sizeof(Pool) + 2 * HeaderSize;
+            const size_t bytes = AlignUp(std::max(m_PoolSize, minimumBlockSize + overhead), Alignment);
+            const size_t payload = bytes - overhead;
+            if (std::bit_width(payload) > FirstLevelMax)
+                return false;
+
+            auto* pool = static_cast<Pool*>(m_Upstream->allocate(bytes, Alignment));
+            pool->Next = m_Pools;
+            pool->Bytes = bytes;
+            m_Pools = pool;
+
+            auto* block = reinterpret_cast<Block*>(pool + 1);
+            block->PrevPhysical = nullptr;
+            block->SizeAndFlags = payload;
+
+            Block* sentinel = block->GetNextPhysical();
+            sentinel->PrevPhysical = block;
+            sentinel->SizeAndFlags = 0;
+
+            InsertFree(block);
+            m_Stats.PoolBytes += bytes;
+            ++m_Stats.PoolCount;
+            return true;
+        }
+
+        void* TLSFResource::Allocate(size_t bytes, size_t alignment)
+        {
+            LM_ASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2");
+
+            const size_t size = AlignUp(std::max(bytes, MinBlockSize), Alignment);
+            // Over-aligned requests need room to carve a free block off the front
+            const size_t search = alignment <= Alignment ? size : size + alignment + HeaderSize + MinBlockSize;
+
+            Block* block = FindFree(search);
+            if (!block)
+            {
+                // Leave room for the search rounding up to the next second-level bin
+                if (!AddPool(search + search / SecondLevelCount))
+                    throw std::bad_alloc();
+                block = FindFree(search);
+            }
+            RemoveFree(block);
+
+            if (alignment > Alignment)
+            {
+                std::byte* payload = block->GetPayload();
+                auto address = reinterpret_cast<uintptr_t>(payload);
+                uintptr_t aligned = AlignUp(address, alignment);
+                if (aligned != address && aligned - address < HeaderSize + MinBlockSize)
+                    aligned += alignment;
+
+                if (aligned != address)
+                {
+                    // The front of the block stays free; the aligned remainder becomes the allocation
+                    Block* front = block;
+                    block = Split(front, static_cast<size_t>(aligned - address) - HeaderSize);
+                    InsertFree(front);
+                }
+            }
+
+            if (Block* rest = Split(block, size))
+                InsertFree(rest);
+
+            block->SetFree(false);
+            m_Stats.UsedBytes += block->GetSize();
+            ++m_Stats.Allocations;
+            return block->GetPayload();
+        }
+
+        void TLSFResource::Deallocate(void* pointer) noexcept
+        {
+            if (!pointer)
+                return;
+
+            Block* block = Block::FromPayload(pointer);
+            LM_ASSERT_MSG(!block->IsFree(), "TLSFResource double free");
+
+            m_Stats.UsedBytes -= block->GetSize();
+            --m_Stats.Allocations;
+            InsertFree(Coalesce(block));
+        }
+
+        bool TLSFResource::CheckIntegrity() const
+        {
+            std::unique_lock lock(m_Mutex, std::defer_lock);
+            if (m_Synchronized)
+                lock.lock();
+
+            size_t freeBlocks = 0;
+            size_t usedBytes = 0;
+            for (Pool* pool = m_Pools; pool; pool = pool->Next)
+            {
+                Block* previous = nullptr;
+                auto* block = reinterpret_cast<Block*>(pool + 1);
+                while (block->GetSize() != 0)
+                {
+                    if (block->PrevPhysical != previous || block->GetSize() % Alignment != 0)
+                        return false;
+                    if (block->IsFree())
+                    {
+                        if (previous && previous->IsFree())
+                            return false; // Two free neighbours should have been coalesced
+                        ++freeBlocks;
+                    }
+                    else
+                    {
+                        usedBytes += block->GetSize();
+                    }
+                    previous = block;
+                    block = block->GetNextPhysical();
+                }
+                if (block->PrevPhysical != previous || reinterpret_cast<std::byte*>(block) + HeaderSize != reinterpret_cast<std::byte*>(pool) + pool->Bytes)
+                    return false;
+            }
+
+            size_t listed = 0;
+            for (uint32_t firstLevel = 0; firstLevel < FirstLevelCount; ++firstLevel)
+            {
+                for (uint32_t secondLevel = 0; secondLevel < SecondLevelCount; ++secondLevel)
+                {
+                    const bool bit = (m_SecondLevelBitmaps[firstLevel] >> secondLevel) & 1u;
+                    if (bit != (m_FreeLists[firstLevel][secondLevel] != nullptr))
+                        return false;
+
+                    for (Block* block = m_FreeLists[firstLevel][secondLevel]; block; block = block->NextFree)
+                    {
+                        uint32_t expectedFirst, expectedSecond;
+                        MappingInsert(block->GetSize(), expectedFirst, expectedSecond);
+                        if (!block->IsFree() || expectedFirst != firstLevel || expectedSecond != secondLevel)
+                            return false;
+                        ++listed;
+                    }
+                }
+                if (((m_FirstLevelBitmap >> firstLevel) & 1u) != (m_SecondLevelBitmaps[firstLevel] != 0))
+                    return false;
+            }
+
+            return listed == freeBlocks && usedBytes == m_Stats.UsedBytes;
+        }
+    }
+}
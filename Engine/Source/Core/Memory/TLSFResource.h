@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        // Two-Level Segregated Fit allocator (Masmano et al., ECRTS '04) as a std::pmr::memory_resource.
+        // Free blocks are binned by a first level (power of two) and a second level (32 linear steps within
+        // it); two bitmaps locate a suitable bin with a couple of bit scans, so allocation and deallocation are
+        // O(1) with no searching. Freed blocks coalesce with their physical neighbours immediately, which
+        // bounds fragmentation. When no block fits, another pool is taken from the upstream resource.
+        //
+        //     Memory::TLSFResource heap(4 * 1024 * 1024);
+        //     std::pmr::vector<Vertex> vertices(&heap);
+        //
+        // Not thread-safe unless constructed with synchronized = true.
+        class TLSFResource : public std::pmr::memory_resource
+        {
+        public:
+            struct Stats
+            {
+                size_t UsedBytes = 0;      // Payload bytes currently allocated (after rounding)
+                size_t PoolBytes = 0;      // Bytes obtained from upstream
+                size_t PoolCount = 0;
+                size_t Allocations = 0;    // Live allocations
+            };
+
+            static constexpr size_t DefaultPoolSize = 1024 * 1024;
+
+            explicit TLSFResource(size_t poolSize = DefaultPoolSize, bool synchronized = false,
+                                  std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+            ~TLSFResource() override;
+
+            TLSFResource(const TLSFResource&) = delete;
+            TLSFResource& operator=(const TLSFResource&) = delete;
+
+            Stats GetStats() const;
+
+            // Walk every pool and check block links, sizes, flags and free lists (debugging aid)
+            bool CheckIntegrity() const;
+
+        private:
+            struct Block;
+            struct Pool;
+
+            static constexpr size_t Alignment = 16;
+            static constexpr uint32_t SecondLevelLog2 = 5;
+            static constexpr uint32_t SecondLevelCount = 1u << SecondLevelLog2;
+            static constexpr uint32_t FirstLevelShift = SecondLevelLog2 + 4;   // log2(Alignment)
+            static constexpr uint32_t FirstLevelMax = 40;                       // Blocks up to 1 TiB
+            static constexpr uint32_t FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+            static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+
+            void* do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+            void* Allocate(size_t bytes, size_t alignment);
+            void Deallocate(void* pointer) noexcept;
+
+            static void MappingInsert(size_t size, uint32_t& firstLevel, uint32_t& secondLevel) noexcept;
+            static void MappingSearch(size_t size, uint32_t& firstLevel, uint32_t& secondLevel) noexcept;
+
+            Block* FindFree(size_t size) noexcept;
+            void InsertFree(Block* block) noexcept;
+            void RemoveFree(Block* block) noexcept;
+            Block* Split(Block* block, size_t size) noexcept;
+            Block* Coalesce(Block* block) noexcept;
+            bool AddPool(size_t minimumBlockSize);
+
+        private:
+            std::pmr::memory_resource* m_Upstream;
+            size_t m_PoolSize;
+            bool m_Synchronized;
+            mutable std::mutex m_Mutex;
+
+            uint32_t m_FirstLevelBitmap = 0;
+            uint32_t m_SecondLevelBitmaps[FirstLevelCount] = {};
+            Block* m_FreeLists[FirstLevelCount][SecondLevelCount] = {};
+
+            Pool* m_Pools = nullptr;
+            Stats m_Stats;
+        };
+    }
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Core/Log.h"
+#include "Core/Memory/VirtualMemory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        // Growable array over a fixed address-space reservation.
+        // The constructor reserves room for maxSize elements up front; pages are committed as the array
+        // grows, so growing never moves elements and pointers, references and iterators stay valid for
+        // as long as the element exists. Reserving costs no physical memory, so maxSize can be generous
+        // (an upper bound such as "a million entities" rather than an estimate).
+        //
+        // With hugePages set, the reservation is aligned to huge pages and committed in huge-page steps
+        // with transparent huge pages requested, cutting TLB misses when iterating large tables.
+        //
+        // Not thread-safe.
+        template<typename T>
+        class VirtualArray
+        {
+        public:
+            using value_type = T;
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            explicit VirtualArray(size_t maxSize, bool hugePages = false)
+                : m_MaxSize(maxSize), m_HugePages(hugePages)
+            {
+                m_Granularity = hugePages ? VirtualMemory::GetHugePageSize() : VirtualMemory::GetPageSize();
+                m_ReservedBytes = RoundUp(std::max<size_t>(maxSize, 1) * sizeof(T));
+                m_Data = static_cast<T*>(VirtualMemory::Reserve(m_ReservedBytes, hugePages));
+                if (!m_Data)
+                {
+                    LM_LOG_CAT_ERROR(Memory, "VirtualArray failed to reserve {} bytes of address space", m_ReservedBytes);
+                    throw std::runtime_error("VirtualArray reservation failed");
+                }
+            }
+
+            ~VirtualArray()
+            {
+                Clear();
+                VirtualMemory::Release(m_Data, m_ReservedBytes);
+            }
+
+            VirtualArray(VirtualArray&& other) noexcept
+                : m_Data(std::exchange(other.m_Data, nullptr)), m_Size(std::exchange(other.m_Size, 0)),
+                  m_MaxSize(other.m_MaxSize), m_CommittedBytes(std::exchange(other.m_CommittedBytes, 0)),
+                  m_ReservedBytes(std::exchange(other.m_ReservedBytes, 0)), m_Granularity(other.m_Granularity),
+                  m_HugePages(other.m_HugePages)
+            {
+            }
+
+            VirtualArray& operator=(VirtualArray&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Clear();
+                    VirtualMemory::Release(m_Data, m_ReservedBytes);
+                    m_Data = std::exchange(other.m_Data, nullptr);
+                    m_Size = std::exchange(other.m_Size, 0);
+                    m_MaxSize = other.m_MaxSize;
+                    m_CommittedBytes = std::exchange(other.m_CommittedBytes, 0);
+                    m_ReservedBytes = std::exchange(other.m_ReservedBytes, 0);
+                    m_Granularity = other.m_Granularity;
+                    m_HugePages = other.m_HugePages;
+                }
+                return *this;
+            }
+
+            VirtualArray(const VirtualArray&) = delete;
+            VirtualArray& operator=(const VirtualArray&) = delete;
+
+            template<typename... Args>
+            T& EmplaceBack(Args&&... args)
+            {
+                if (m_Size == Capacity())
+                    Grow(m_Size + 1);
+                T* element = new (m_Data + m_Size) T(std::forward<Args>(args)...);
+                ++m_Size;
+                return *element;
+            }
+
+            void PushBack(const T& value) { EmplaceBack(value); }
+            void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+            void PopBack() noexcept
+            {
+                LM_ASSERT_MSG(m_Size > 0, "PopBack on an empty VirtualArray");
+                std::destroy_at(m_Data + --m_Size);
+            }
+
+            // New elements are value-initialized
+            void Resize(size_t size)
+            {
+                if (size > m_Size)
+                {
+                    Reserve(size);
+                    std::uninitialized_value_construct(m_Data + m_Size, m_Data + size);
+                }
+                else
+                {
+                    std::destroy(m_Data + size, m_Data + m_Size);
+                }
+                m_Size = size;
+            }
+
+            // Commit pages for at least capacity elements
+            void Reserve(size_t capacity)
+            {
+                if (capacity > Capacity())
+                    Grow(capacity);
+            }
+
+            void Clear() noexcept
+            {
+                std::destroy(m_Data, m_Data + m_Size);
+                m_Size = 0;
+            }
+
+            // Decommit pages beyond the ones the current elements need
+            void ShrinkToFit() noexcept
+            {
+                const size_t needed = RoundUp(m_Size * sizeof(T));
+                if (needed < m_CommittedBytes)
+                {
+                    VirtualMemory::Decommit(reinterpret_cast<std::byte*>(m_Data) + needed, m_CommittedBytes - needed);
+                    m_CommittedBytes = needed;
+                }
+            }
+
+            T& operator[](size_t index) noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "VirtualArray index {} out of range ({})", index, m_Size);
+                return m_Data[index];
+            }
+
+            const T& operator[](size_t index) const noexcept
+            {
+                LM_ASSERT_MSG(index < m_Size, "VirtualArray index {} out of range ({})", index, m_Size);
+                return m_Data[index];
+            }
+
+            T& Back() noexcept { return m_Data[m_Size - 1]; }
+            const T& Back() const noexcept { return m_Data[m_Size - 1]; }
+
+            T* Data() noexcept { return m_Data; }
+            const T* Data() const noexcept { return m_Data; }
+            iterator begin() noexcept { return m_Data; }
+            iterator end() noexcept { return m_Data + m_Size; }
+            const_iterator begin() const noexcept { return m_Data; }
+            const_iterator end() const noexcept { return m_Data + m_Size; }
+
+            size_t Size() const noexcept { return m_Size; }
+            bool Empty() const noexcept { return m_Size == 0; }
+            size_t Capacity() const noexcept { return std::min(m_CommittedBytes / sizeof(T), m_MaxSize); }
+            size_t MaxSize() const noexcept { return m_MaxSize; }
+            size_t GetCommittedBytes() const noexcept { return m_CommittedBytes; }
+            bool UsesHugePages() const noexcept { return m_HugePages; }
+
+        private:
+            size_t RoundUp(size_t bytes) const noexcept
+            {
+                return (bytes + m_Granularity - 1) / m_Granularity * m_Granularity;
+            }
+
+            void Grow(size_t capacity)
+            {
+                if (capacity > m_MaxSize)
+                {
+                    LM_LOG_CAT_ERROR(Memory, "VirtualArray grew past its reserved maximum of {} elements", m_MaxSize);
+                    throw std::runtime_error("VirtualArray exceeded its reservation");
+                }
+
+                // Commit geometrically so a long run of pushes costs O(log n) system calls
+                size_t target = std::max(capacity * sizeof(T), m_CommittedBytes * 2);
+                target = std::min(RoundUp(target), m_ReservedBytes);
+
+                auto* base = reinterpret_cast<std::byte*>(m_Data);
+                if (!VirtualMemory::Commit(base + m_CommittedBytes, target - m_CommittedBytes, m_HugePages))
+                    throw std::bad_alloc();
+                m_CommittedBytes = target;
+            }
+
+            T* m_Data = nullptr;
+            size_t m_Size = 0;
+            size_t m_MaxSize = 0;
+            size_t m_CommittedBytes = 0;
+            size_t m_ReservedBytes = 0;
+            size_t m_Granularity = 0;
+            bool m_HugePages = false;
+        };
+    }
+}
@@ -0,0 +1,123 @@
+#include "lmpch.h"
+#include "Core/Memory/VirtualMemory.h"
+
+#include <cstdint>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fstream>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        size_t VirtualMemory::GetPageSize() noexcept
+        {
+#if defined(_WIN32)
+            // Reservations are made at allocation granularity (64 KiB), so commit in the same units
+            static const size_t pageSize = []()
+            {
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return static_cast<size_t>(info.dwAllocationGranularity);
+            }();
+#else
+            static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+            return pageSize;
+        }
+
+        size_t VirtualMemory::GetHugePageSize() noexcept
+        {
+#if defined(LM_PLATFORM_LINUX)
+            static const size_t hugePageSize = []()
+            {
+                size_t size = 0;
+                std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+                if (!(file >> size) || size < GetPageSize())
+                    size = 2 * 1024 * 1024;
+                return size;
+            }();
+            return hugePageSize;
+#else
+            // Windows large pages need SeLockMemoryPrivilege and macOS has no transparent huge pages
+            return GetPageSize();
+#endif
+        }
+
+        void* VirtualMemory::Reserve(size_t bytes, bool hugePages) noexcept
+        {
+#if defined(_WIN32)
+            (void)hugePages;
+            return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+            const size_t alignment = hugePages ? GetHugePageSize() : GetPageSize();
+            const size_t padded = bytes + (alignment > GetPageSize() ? alignment : 0);
+
+            void* raw = mmap(nullptr, padded, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (raw == MAP_FAILED)
+                return nullptr;
+            if (padded == bytes)
+                return raw;
+
+            // Trim the over-reservation so the region starts on a huge page boundary
+            const uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+            const uintptr_t aligned = (start + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            if (aligned > start)
+                munmap(raw, aligned - start);
+            const size_t tail = (start + padded) - (aligned + bytes);
+            if (tail > 0)
+                munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+            return reinterpret_cast<void*>(aligned);
+#endif
+        }
+
+        bool VirtualMemory::Commit(void* address, size_t bytes, bool hugePages) noexcept
+        {
+#if defined(_WIN32)
+            (void)hugePages;
+            return VirtualAlloc(address, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+            if (mprotect(address, bytes, PROT_READ | PROT_WRITE) != 0)
+                return false;
+    #if defined(MADV_HUGEPAGE)
+            // Advisory: the kernel backs the range with huge pages when it can and falls back silently
+            if (hugePages)
+                madvise(address, bytes, MADV_HUGEPAGE);
+    #else
+            (void)hugePages;
+    #endif
+            return true;
+#endif
+        }
+
+        void VirtualMemory::Decommit(void* address, size_t bytes) noexcept
+        {
+#if defined(_WIN32)
+            VirtualFree(address, bytes, MEM_DECOMMIT);
+#else
+            // Mapping fresh inaccessible pages over the range drops the old ones
+            mmap(address, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+#endif
+        }
+
+        void VirtualMemory::Release(void* address, size_t bytes) noexcept
+        {
+            if (!address)
+                return;
+#if defined(_WIN32)
+            (void)bytes;
+            VirtualFree(address, 0, MEM_RELEASE);
+#else
+            munmap(address, bytes);
+#endif
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Limitless
+{
+    namespace Memory
+    {
+        // Thin wrapper over the OS virtual memory API (mmap/mprotect on POSIX, VirtualAlloc on Windows).
+        // Reserving claims address space only; pages cost physical memory once committed. All sizes and
+        // addresses passed to Commit/Decommit must be multiples of the granularity the region was reserved with.
+        class VirtualMemory
+        {
+        public:
+            static size_t GetPageSize() noexcept;
+
+            // Transparent huge page size (2 MiB on x64/ARM64 Linux), or the regular page size where
+            // huge pages are not available without special privileges
+            static size_t GetHugePageSize() noexcept;
+
+            // Reserve bytes of inaccessible address space, aligned to GetHugePageSize() when hugePages is set.
+            // Returns nullptr on failure.
+            static void* Reserve(size_t bytes, bool hugePages = false) noexcept;
+
+            // Make a reserved range readable and writable. Returns false when the OS refuses (out of memory).
+            static bool Commit(void* address, size_t bytes, bool hugePages = false) noexcept;
+
+            // Return a committed range's physical pages to the OS; the address range stays reserved
+            static void Decommit(void* address, size_t bytes) noexcept;
+
+            // Release a whole reservation made by Reserve
+            static void Release(void* address, size_t bytes) noexcept;
+        };
+    }
+}
@@ -15,7 +15,7 @@ namespace Limitless {
         if (refCount_ == 0) {
             ApplyRecommendedHints();
             if (!SDL_Init(mask)) {
-                LM_CORE_LOG_ERROR("SDL_Init failed: {}", GetLastError());
+                LM_LOG_CAT_ERROR(Platform, "SDL_Init failed: {}", GetLastError());
                 return false;
             }
             initMask_ = mask;
@@ -24,11 +24,11 @@ namespace Limitless {
             uint32_t newMask = mask & ~initMask_;
             if (newMask) {
                 if (!SDL_InitSubSystem(newMask)) {
-                    LM_CORE_LOG_ERROR("SDL_InitSubSystem failed: {}", GetLastError());
+                    LM_LOG_CAT_ERROR(Platform, "SDL_InitSubSystem failed: {}", GetLastError());
                     return false;
                 }
                 initMask_ |= newMask;
-                LM_CORE_LOG_INFO("SDL subsystems extended. InitMask=0x{:X}", initMask_);
+                LM_LOG_CAT_INFO(Platform, "SDL subsystems extended. InitMask=0x{:X}", initMask_);
             }
         }
         ++refCount_;
@@ -41,7 +41,7 @@ namespace Limitless {
         --refCount_;
         if (refCount_ == 0) {
             SDL_Quit();
-            LM_CORE_LOG_INFO("SDL shut down");
+            LM_LOG_CAT_INFO(Platform, "SDL shut down");
             initMask_ = 0;
         }
     }
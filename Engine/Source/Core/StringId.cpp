@@ -0,0 +1,124 @@
+#include "lmpch.h"
+#include "Core/StringId.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Limitless
+{
+    namespace
+    {
+        struct InternTable
+        {
+            std::shared_mutex Mutex;
+            std::pmr::monotonic_buffer_resource Storage{ 16 * 1024 };   // Strings live as long as the process
+            std::unordered_map<uint64_t, std::string_view> Names;
+            size_t Collisions = 0;
+        };
+
+        InternTable& GetTable()
+        {
+            // Intentionally leaked: ids may be built during static initialization and destruction
+            static InternTable* table = []()
+            {
+                LM_MEMTAG(Core);
+                return new InternTable();
+            }();
+            return *table;
+        }
+
+        std::string_view Find(InternTable& table, uint64_t hash)
+        {
+            std::shared_lock lock(table.Mutex);
+            auto it = table.Names.find(hash);
+            return it != table.Names.end() ? it->second : std::string_view();
+        }
+
+        void Insert(uint64_t hash, std::string_view string)
+        {
+            InternTable& table = GetTable();
+
+            // Fast path: already known (shared lock only)
+            std::string_view existing;
+            bool found;
+            {
+                std::shared_lock lock(table.Mutex);
+                auto it = table.Names.find(hash);
+                found = it != table.Names.end();
+                if (found)
+                    existing = it->second;
+            }
+
+            if (!found)
+            {
+                LM_MEMTAG(Core);
+                std::unique_lock lock(table.Mutex);
+                auto [it, inserted] = table.Names.try_emplace(hash);
+                if (inserted)
+                {
+                    auto* copy = static_cast<char*>(table.Storage.allocate(string.size() + 1, 1));
+                    std::memcpy(copy, string.data(), string.size());
+                    copy[string.size()] = '\0';
+                    it->second = std::string_view(copy, string.size());
+                    return;
+                }
+                existing = it->second;
+            }
+
+            if (existing != string)
+            {
+                {
+                    std::unique_lock lock(table.Mutex);
+                    ++table.Collisions;
+                }
+                LM_LOG_CAT_ERROR(Core, "StringId collision: '{}' and '{}' both hash to {:016x}", existing, string, hash);
+            }
+        }
+    }
+
+    StringId StringId::Intern(std::string_view string)
+    {
+        const uint64_t hash = Hash(string);
+        Insert(hash, string);
+        return StringId(hash);
+    }
+
+    void StringId::Register(uint64_t hash, std::string_view string)
+    {
+        Insert(hash, string);
+    }
+
+    std::string_view StringId::GetString() const
+    {
+        return Find(GetTable(), m_Hash);
+    }
+
+    std::string StringId::ToString() const
+    {
+        std::string_view name = GetString();
+        if (!name.empty() || m_Hash == Hash(""))
+            return std::string(name);
+
+        char buffer[20];
+        std::snprintf(buffer, sizeof(buffer), "#%016llx", static_cast<unsigned long long>(m_Hash));
+        return buffer;
+    }
+
+    size_t StringId::GetInternedCount()
+    {
+        InternTable& table = GetTable();
+        std::shared_lock lock(table.Mutex);
+        return table.Names.size();
+    }
+
+    size_t StringId::GetCollisionCount()
+    {
+        InternTable& table = GetTable();
+        std::shared_lock lock(table.Mutex);
+        return table.Collisions;
+    }
+}
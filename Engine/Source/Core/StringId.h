@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Core/Log.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Reverse lookup and collision detection cost a locked table insert per runtime-built id, so only Debug
+// builds pay for them
+#if defined(LM_DEBUG)
+    #define LM_STRINGID_DEBUG 1
+#endif
+
+namespace Limitless
+{
+    // Name reduced to a 64-bit FNV-1a hash. Comparing, hashing and switching on ids are integer operations;
+    // the string is only hashed where the id is built, and ids built from literals are hashed at compile time:
+    //
+    //     switch (event.Name.GetHash())
+    //     {
+    //         case "player_died"_sid.GetHash(): ...
+    //     }
+    //
+    // In Debug builds every id built at runtime is recorded in a process-wide table, which backs
+    // GetString() and reports two different strings hashing to the same id. Literal ids are recorded
+    // once the same name is built at runtime or interned anywhere.
+    class StringId
+    {
+    public:
+        static constexpr uint64_t OffsetBasis = 14695981039346656037ull;
+        static constexpr uint64_t Prime = 1099511628211ull;
+
+        static constexpr uint64_t Hash(std::string_view string) noexcept
+        {
+            uint64_t hash = OffsetBasis;
+            for (char c : string)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= Prime;
+            }
+            return hash;
+        }
+
+        constexpr StringId() noexcept = default;
+        constexpr explicit StringId(uint64_t hash) noexcept : m_Hash(hash) {}
+
+        constexpr explicit StringId(std::string_view string) : m_Hash(Hash(string))
+        {
+#if defined(LM_STRINGID_DEBUG)
+            if (!std::is_constant_evaluated())
+                Register(m_Hash, string);
+#endif
+        }
+
+        // Build an id and keep its string for GetString in every configuration, Release and Dist included
+        static StringId Intern(std::string_view string);
+
+        constexpr uint64_t GetHash() const noexcept { return m_Hash; }
+        constexpr bool IsValid() const noexcept { return m_Hash != 0; }
+
+        // The registered string, or an empty view when the id was never built at runtime or interned
+        std::string_view GetString() const;
+
+        // The string when known, otherwise the hash as "#0123456789abcdef"
+        std::string ToString() const;
+
+        constexpr bool operator==(const StringId&) const noexcept = default;
+        constexpr auto operator<=>(const StringId&) const noexcept = default;
+
+        // Number of distinct strings in the table, and of strings rejected because another string owns their hash
+        static size_t GetInternedCount();
+        static size_t GetCollisionCount();
+
+    private:
+        static void Register(uint64_t hash, std::string_view string);
+
+        uint64_t m_Hash = 0;
+    };
+
+    inline namespace Literals
+    {
+        consteval StringId operator""_sid(const char* string, size_t length)
+        {
+            return StringId(StringId::Hash(std::string_view(string, length)));
+        }
+    }
+}
+
+template<>
+struct std::hash<Limitless::StringId>
+{
+    // FNV-1a output is already well mixed
+    size_t operator()(const Limitless::StringId& id) const noexcept { return static_cast<size_t>(id.GetHash()); }
+};
+
+template<>
+struct fmt::formatter<Limitless::StringId> : fmt::formatter<std::string_view>
+{
+    template<typename FormatContext>
+    auto format(const Limitless::StringId& id, FormatContext& context) const
+    {
+        return fmt::formatter<std::string_view>::format(id.ToString(), context);
+    }
+};
@@ -34,7 +34,7 @@ namespace Limitless {
         window_ = SDL_CreateWindow(desc.title.c_str(), desc.width, desc.height, flags);
         if (!window_) {
             auto err = SDLManager::GetLastError();
-            LM_CORE_LOG_ERROR("SDL_CreateWindow failed: {}", err);
+            LM_LOG_CAT_ERROR(Platform, "SDL_CreateWindow failed: {}", err);
             throw std::runtime_error("SDL_CreateWindow failed: " + err);
         }
         width_ = desc.width;
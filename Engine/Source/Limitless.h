@@ -3,6 +3,21 @@
 #include "Core/EntryPoint.h"
 #include "Core/Application.h"
 #include "Core/SDLManager.h"
+#include "Core/StringId.h"
 #include "Core/Window.h"
+#include "Core/Concurrency/Epoch.h"
+#include "Core/Concurrency/JobSystem.h"
+#include "Core/Concurrency/MainThreadDispatcher.h"
+#include "Core/Concurrency/Task.h"
+#include "Core/Concurrency/TaskGraph.h"
+#include "Core/Containers/FixedVector.h"
+#include "Core/Containers/FlatHashMap.h"
+#include "Core/Containers/HandlePool.h"
+#include "Core/Containers/SmallVector.h"
+#include "Core/Logging/DeferredLog.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Memory/TLSFResource.h"
+#include "Core/Memory/VirtualArray.h"
 #include "Renderer/RenderAPI.h"
 #include "Renderer/RenderCommand.h"
\ No newline at end of file
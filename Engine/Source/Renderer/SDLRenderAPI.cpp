@@ -10,7 +10,7 @@ namespace Limitless {
         SDL_Window* sdlWindow = window.GetNativeHandle();
         sdlRenderer_ = SDL_CreateRenderer(sdlWindow, nullptr);
         if (!sdlRenderer_) {
-            LM_CORE_LOG_ERROR("SDL_CreateRenderer failed: {}", SDL_GetError());
+            LM_LOG_CAT_ERROR(Renderer, "SDL_CreateRenderer failed: {}", SDL_GetError());
             throw std::runtime_error("SDL_CreateRenderer failed");
         }
 
@@ -90,7 +90,7 @@ project "Engine"
             }
 
     filter "configurations:Debug"
-        defines { "LM_DEBUG", "SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_TRACE" }
+        defines { "LM_DEBUG", "SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_TRACE", "LM_MEMORY_TRACKING" }
         runtime "Debug"
         symbols "on"
 
@@ -103,3 +103,8 @@ project "Engine"
         defines { "LM_DIST", "SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_INFO" }
         runtime "Release"
         optimize "on"
+
+    -- The global new/delete hooks add a header and several atomics to every allocation, so Release only
+    -- tracks when asked to: premake5 --memory-tracking <action>
+    filter { "configurations:Release", "options:memory-tracking" }
+        defines { "LM_MEMORY_TRACKING" }
@@ -0,0 +1,240 @@
+#include "Core/Logging/BinaryLog.h"
+#include "Core/Logging/FlightRecorderSink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <string_view>
+
+using namespace Limitless;
+
+namespace
+{
+    const char* LevelName(LogLevel level)
+    {
+        switch (level)
+        {
+            case LogLevel::Trace:    return "trace";
+            case LogLevel::Debug:    return "debug";
+            case LogLevel::Info:     return "info";
+            case LogLevel::Warn:     return "warning";
+            case LogLevel::Error:    return "error";
+            case LogLevel::Critical: return "critical";
+            default:                 return "off";
+        }
+    }
+
+    std::optional<LogLevel> ParseLevel(std::string_view name)
+    {
+        for (int i = 0; i <= static_cast<int>(LogLevel::Off); ++i)
+        {
+            if (name == LevelName(static_cast<LogLevel>(i)))
+                return static_cast<LogLevel>(i);
+        }
+        if (name == "warn")
+            return LogLevel::Warn;
+        return std::nullopt;
+    }
+
+    std::optional<LogCategory> ParseCategory(std::string_view name)
+    {
+        for (int i = 0; i < static_cast<int>(LogCategory::Count); ++i)
+        {
+            if (name == ToString(static_cast<LogCategory>(i)))
+                return static_cast<LogCategory>(i);
+        }
+        return std::nullopt;
+    }
+
+    // Same layout as the engine's file sink pattern: [%Y-%m-%d %T.%e]
+    std::string FormatTime(uint64_t timestampNs)
+    {
+        const std::time_t seconds = static_cast<std::time_t>(timestampNs / 1000000000ull);
+        const unsigned milliseconds = static_cast<unsigned>(timestampNs / 1000000ull % 1000ull);
+        std::tm tm{};
+#if defined(_WIN32)
+        localtime_s(&tm, &seconds);
+#else
+        localtime_r(&seconds, &tm);
+#endif
+        char buffer[32]{};
+        const size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &tm);
+        std::snprintf(buffer + length, sizeof(buffer) - length, ".%03u", milliseconds);
+        return buffer;
+    }
+
+    int Decode(int argc, char** argv)
+    {
+        const char* path = nullptr;
+        LogLevel minimumLevel = LogLevel::Trace;
+        std::optional<LogCategory> category;
+
+        for (int i = 0; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--level") == 0 && i + 1 < argc)
+            {
+                auto level = ParseLevel(argv[++i]);
+                if (!level)
+                {
+                    std::fprintf(stderr, "unknown level '%s'\n", argv[i]);
+                    return 2;
+                }
+                minimumLevel = *level;
+            }
+            else if (std::strcmp(argv[i], "--category") == 0 && i + 1 < argc)
+            {
+                category = ParseCategory(argv[++i]);
+                if (!category)
+                {
+                    std::fprintf(stderr, "unknown category '%s'\n", argv[i]);
+                    return 2;
+                }
+            }
+            else if (!path)
+            {
+                path = argv[i];
+            }
+            else
+            {
+                std::fprintf(stderr, "unexpected argument '%s'\n", argv[i]);
+                return 2;
+            }
+        }
+
+        if (!path)
+        {
+            std::fprintf(stderr, "decode: missing file\n");
+            return 2;
+        }
+
+        Logging::BinaryLogReader reader(path);
+        if (!reader.IsOpen())
+        {
+            std::fprintf(stderr, "decode: %s\n", reader.GetError().c_str());
+            return 1;
+        }
+
+        Logging::BinaryLogReader::Entry entry;
+        while (reader.Next(entry))
+        {
+            if (entry.Level < minimumLevel || (category && entry.Category != *category))
+                continue;
+            std::printf("[%s] [%s] [%s] %s (%.*s:%u) [%llu]\n", FormatTime(entry.TimestampNs).c_str(),
+                        LevelName(entry.Level), ToString(entry.Category), entry.Message.c_str(),
+                        static_cast<int>(entry.File.size()), entry.File.data(), entry.Line,
+                        static_cast<unsigned long long>(entry.ThreadId));
+        }
+        if (!reader.IsOpen())
+        {
+            std::fprintf(stderr, "decode: %s\n", reader.GetError().c_str());
+            return 1;
+        }
+        return 0;
+    }
+
+    int Recover(int argc, char** argv)
+    {
+        const char* path = nullptr;
+        const char* outputPath = nullptr;
+        LogLevel minimumLevel = LogLevel::Trace;
+
+        for (int i = 0; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            {
+                outputPath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--level") == 0 && i + 1 < argc)
+            {
+                auto level = ParseLevel(argv[++i]);
+                if (!level)
+                {
+                    std::fprintf(stderr, "unknown level '%s'\n", argv[i]);
+                    return 2;
+                }
+                minimumLevel = *level;
+            }
+            else if (!path)
+            {
+                path = argv[i];
+            }
+            else
+            {
+                std::fprintf(stderr, "unexpected argument '%s'\n", argv[i]);
+                return 2;
+            }
+        }
+
+        if (!path)
+        {
+            std::fprintf(stderr, "recover: missing file\n");
+            return 2;
+        }
+
+        Logging::FlightRecording recording;
+        std::string error;
+        if (!Logging::RecoverFlightRecording(path, recording, error))
+        {
+            std::fprintf(stderr, "recover: %s\n", error.c_str());
+            return 1;
+        }
+
+        std::FILE* output = stdout;
+        if (outputPath)
+        {
+            output = std::fopen(outputPath, "wb");
+            if (!output)
+            {
+                std::fprintf(stderr, "recover: cannot write '%s'\n", outputPath);
+                return 1;
+            }
+        }
+
+        for (const auto& record : recording.Records)
+        {
+            if (record.Level >= minimumLevel)
+                std::fwrite(record.Text.data(), 1, record.Text.size(), output);
+        }
+        if (output != stdout)
+            std::fclose(output);
+
+        // Summary on stderr so stdout stays a clean log
+        std::fprintf(stderr, "recovered %zu records from process %llu started %s",
+                     recording.Records.size(), static_cast<unsigned long long>(recording.ProcessId),
+                     FormatTime(recording.StartTimeNs).c_str());
+        if (recording.LostRecords > 0)
+            std::fprintf(stderr, " (%llu older records overwritten or damaged)", static_cast<unsigned long long>(recording.LostRecords));
+        std::fprintf(stderr, "\n");
+        return 0;
+    }
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: LogTools <command> [args]\n"
+            "  decode <file.lmlog> [--level <level>] [--category <name>]\n"
+            "      Print the events of a binary log written by DeferredLog as text\n"
+            "  recover <file.flight> [--level <level>] [--output <file>]\n"
+            "      Extract the records of a flight recorder ring left behind by a crashed process\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    if (std::strcmp(argv[1], "decode") == 0)
+        return Decode(argc - 2, argv + 2);
+    if (std::strcmp(argv[1], "recover") == 0)
+        return Recover(argc - 2, argv + 2);
+
+    PrintUsage();
+    return 2;
+}
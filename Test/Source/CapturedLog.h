@@ -0,0 +1,26 @@
+#pragma once
+
+#include <spdlog/logger.h>
+#include <spdlog/sinks/ringbuffer_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <memory>
+
+// Routes the fallback logger (no Log::Init in tests) into a ring buffer for the test's duration. Lines are
+// formatted with "%v", so checks see the message text only.
+struct CapturedLog {
+    std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> Sink;
+    std::shared_ptr<spdlog::logger> Previous = spdlog::default_logger();
+
+    explicit CapturedLog(size_t lines = 64) : Sink(std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(lines)) {
+        auto logger = std::make_shared<spdlog::logger>("captured", Sink);
+        logger->set_pattern("%v");
+        logger->set_level(spdlog::level::trace);
+        spdlog::set_default_logger(logger);
+    }
+    ~CapturedLog() { spdlog::set_default_logger(Previous); }
+
+    CapturedLog(const CapturedLog&) = delete;
+    CapturedLog& operator=(const CapturedLog&) = delete;
+};
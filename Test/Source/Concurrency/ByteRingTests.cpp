@@ -0,0 +1,95 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/ByteRing.h"
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+using namespace Limitless::Concurrency;
+
+TEST_CASE("SPSCByteRing: records round-trip in place") {
+    SPSCByteRing ring(256);
+    CHECK(ring.GetCapacity() == 256);
+    CHECK(ring.TryRead().empty());
+
+    const std::string hello = "hello";
+    CHECK(ring.TryWrite(hello.data(), hello.size()));
+
+    auto bytes = ring.Reserve(32);
+    REQUIRE(bytes.size() == 32);
+    std::memcpy(bytes.data(), "abc", 3);
+    ring.Commit(3); // Shrink to what was actually written
+
+    auto first = ring.TryRead();
+    REQUIRE(first.size() == hello.size());
+    CHECK(std::memcmp(first.data(), hello.data(), hello.size()) == 0);
+    ring.Consume();
+
+    auto second = ring.TryRead();
+    REQUIRE(second.size() == 3);
+    CHECK(std::memcmp(second.data(), "abc", 3) == 0);
+    ring.Consume();
+
+    CHECK(ring.IsEmpty());
+}
+
+TEST_CASE("SPSCByteRing: wraps with padding and keeps payloads contiguous") {
+    SPSCByteRing ring(128);
+    std::byte payload[40];
+
+    // 40-byte payloads take 48 bytes each; the third no longer fits before the end and must wrap
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 2; ++i) {
+            std::memset(payload, round * 2 + i, sizeof(payload));
+            REQUIRE(ring.TryWrite(payload, sizeof(payload)));
+        }
+        for (int i = 0; i < 2; ++i) {
+            auto record = ring.TryRead();
+            REQUIRE(record.size() == sizeof(payload));
+            CHECK(record.front() == std::byte(round * 2 + i));
+            CHECK(record.back() == std::byte(round * 2 + i));
+            ring.Consume();
+        }
+    }
+    CHECK(ring.IsEmpty());
+    CHECK(ring.Reserve(ring.GetMaxRecordSize() + 1).empty());
+}
+
+TEST_CASE("SPSCByteRing: concurrent producer and consumer with variable sizes") {
+    constexpr uint32_t Records = 50000;
+    SPSCByteRing ring(4096);
+
+    std::thread producer([&ring]() {
+        for (uint32_t i = 0; i < Records; ++i) {
+            size_t size = sizeof(uint32_t) + (i * 7) % 200;
+            std::span<std::byte> bytes;
+            while ((bytes = ring.Reserve(size)).empty())
+                std::this_thread::yield();
+            std::memcpy(bytes.data(), &i, sizeof(i));
+            std::memset(bytes.data() + sizeof(i), static_cast<int>(i & 0xFF), size - sizeof(i));
+            ring.Commit();
+        }
+    });
+
+    bool intact = true;
+    for (uint32_t expected = 0; expected < Records;) {
+        auto record = ring.TryRead();
+        if (record.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t value = 0;
+        std::memcpy(&value, record.data(), sizeof(value));
+        intact &= value == expected;
+        intact &= record.size() == sizeof(uint32_t) + (expected * 7) % 200;
+        if (record.size() > sizeof(uint32_t))
+            intact &= record.back() == std::byte(expected & 0xFF);
+        ring.Consume();
+        ++expected;
+    }
+    producer.join();
+
+    CHECK(intact);
+    CHECK(ring.IsEmpty());
+}
@@ -0,0 +1,107 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/Epoch.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Concurrency;
+
+namespace {
+    std::atomic<int> s_Freed{ 0 };
+
+    struct Tracked {
+        static constexpr uint32_t Alive = 0xA11FE;
+        explicit Tracked(int value) : Value(value) {}
+        ~Tracked() {
+            Magic = 0;
+            s_Freed.fetch_add(1, std::memory_order_relaxed);
+        }
+        uint32_t Magic = Alive;
+        int Value;
+    };
+
+    // With nothing pinned, three collects advance the epoch past anything retired so far
+    void CollectAll(EpochManager& epochs) {
+        for (int i = 0; i < 3; ++i)
+            epochs.Collect();
+    }
+}
+
+TEST_CASE("EpochManager: retired objects outlive pinned readers") {
+    auto& epochs = EpochManager::Get();
+    CollectAll(epochs);
+    s_Freed = 0;
+
+    std::atomic<bool> pinned{ false }, release{ false };
+    std::thread reader([&]() {
+        EpochManager::Guard guard;
+        pinned = true;
+        while (!release.load())
+            std::this_thread::yield();
+    });
+    while (!pinned.load())
+        std::this_thread::yield();
+
+    epochs.Retire(new Tracked(1));
+    for (int i = 0; i < 8; ++i)
+        epochs.Collect();
+    CHECK(s_Freed.load() == 0); // The reader pinned before the retire still holds it back
+
+    release = true;
+    reader.join();
+    CollectAll(epochs);
+    CHECK(s_Freed.load() == 1);
+    CHECK(epochs.GetPendingCount() == 0);
+}
+
+TEST_CASE("EpochManager: guards nest") {
+    auto& epochs = EpochManager::Get();
+    CHECK_FALSE(epochs.IsPinned());
+    {
+        EpochManager::Guard outer;
+        {
+            EpochManager::Guard inner;
+            CHECK(epochs.IsPinned());
+        }
+        CHECK(epochs.IsPinned());
+    }
+    CHECK_FALSE(epochs.IsPinned());
+}
+
+TEST_CASE("EpochManager: readers never see a freed object under concurrent replacement") {
+    auto& epochs = EpochManager::Get();
+    CollectAll(epochs);
+    s_Freed = 0;
+
+    constexpr int Replacements = 20000;
+    std::atomic<Tracked*> shared{ new Tracked(0) };
+    std::atomic<bool> stop{ false };
+    std::atomic<bool> intact{ true };
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                EpochManager::Guard guard;
+                Tracked* current = shared.load(std::memory_order_acquire);
+                if (current->Magic != Tracked::Alive)
+                    intact = false;
+            }
+        });
+    }
+
+    for (int i = 1; i <= Replacements; ++i) {
+        Tracked* old = shared.exchange(new Tracked(i), std::memory_order_acq_rel);
+        epochs.Retire(old);
+    }
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    CollectAll(epochs);
+    CHECK(intact.load());
+    CHECK(s_Freed.load() == Replacements);
+    delete shared.load();
+}
@@ -0,0 +1,81 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/JobSystem.h"
+
+#include <atomic>
+#include <numeric>
+
+using namespace Limitless::Concurrency;
+
+TEST_CASE("JobSystem: ParallelFor visits every index exactly once") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(4);
+
+    std::vector<std::atomic<int>> hits(10000);
+    jobs.ParallelFor(static_cast<uint32_t>(hits.size()), 64, [&](uint32_t i) {
+        hits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    bool allOnce = std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) { return h.load() == 1; });
+    CHECK(allOnce);
+
+    jobs.Shutdown();
+}
+
+TEST_CASE("JobSystem: counters wait for nested jobs") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(4);
+
+    std::atomic<int> sum{ 0 };
+    JobCounter outer;
+    for (int i = 0; i < 32; ++i) {
+        jobs.Run([&jobs, &sum]() {
+            JobCounter inner;
+            for (int j = 0; j < 32; ++j)
+                jobs.Run([&sum]() { sum.fetch_add(1, std::memory_order_relaxed); }, &inner);
+            jobs.Wait(inner);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+    CHECK(outer.IsDone());
+    CHECK(sum.load() == 32 * 32);
+
+    jobs.Shutdown();
+}
+
+TEST_CASE("JobSystem: handles and ParallelInvoke") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(2);
+
+    std::atomic<int> value{ 0 };
+    JobHandle handle = jobs.Schedule([&value]() { value = 42; });
+    handle.Wait();
+    CHECK(handle.IsDone());
+    CHECK(value.load() == 42);
+
+    int a = 0, b = 0, c = 0;
+    jobs.ParallelInvoke([&a]() { a = 1; }, [&b]() { b = 2; }, [&c]() { c = 3; });
+    CHECK(a + b + c == 6);
+
+    jobs.Shutdown();
+}
+
+TEST_CASE("JobSystem: a discarded handle does not end the counter's lifetime") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(4);
+
+    constexpr int Count = 10000;
+    std::atomic<int> ran{ 0 };
+    for (int i = 0; i < Count; ++i)
+        (void)jobs.Schedule([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); });
+
+    // Shutdown drains everything, so every job decremented a counter nobody else still owned
+    jobs.Shutdown();
+    CHECK(ran.load() == Count);
+}
+
+TEST_CASE("JobSystem: runs inline when not initialized") {
+    int ran = 0;
+    JobSystem::Get().Run([&ran]() { ++ran; });
+    CHECK(ran == 1);
+}
@@ -0,0 +1,190 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/LockFreeQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Concurrency;
+
+TEST_CASE("LockFreeMPMCQueue: fills to capacity and drains in order") {
+    LockFreeMPMCQueue<int, 8> queue;
+    for (int i = 0; i < 8; ++i)
+        CHECK(queue.TryPush(int(i)));
+    CHECK(queue.IsFull());
+    CHECK_FALSE(queue.TryPush(99));
+
+    for (int i = 0; i < 8; ++i) {
+        auto item = queue.TryPop();
+        REQUIRE(item.has_value());
+        CHECK(*item == i);
+    }
+    CHECK(queue.IsEmpty());
+    CHECK_FALSE(queue.TryPop().has_value());
+}
+
+TEST_CASE("LockFreeMPMCQueue: bulk push/pop and move-only items") {
+    LockFreeMPMCQueue<std::unique_ptr<int>, 16> queue;
+
+    std::unique_ptr<int> in[20];
+    for (int i = 0; i < 20; ++i)
+        in[i] = std::make_unique<int>(i);
+
+    CHECK(queue.TryPushBulk(in, 20) == 16);
+    CHECK(in[0] == nullptr);
+    CHECK(in[16] != nullptr);
+
+    std::unique_ptr<int> out[10];
+    CHECK(queue.TryPopBulk(out, 10) == 10);
+    CHECK(*out[0] == 0);
+    CHECK(*out[9] == 9);
+    CHECK(queue.GetSize() == 6);
+}
+
+TEST_CASE("LockFreeMPMCQueue: concurrent producers and consumers lose nothing") {
+    constexpr int Producers = 4;
+    constexpr int Consumers = 4;
+    constexpr int PerProducer = 20000;
+
+    LockFreeMPMCQueue<int, 1024> queue;
+    std::atomic<long long> consumedSum{ 0 };
+    std::atomic<int> consumedCount{ 0 };
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < Producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 1; i <= PerProducer; ++i) {
+                int value = p * PerProducer + i;
+                while (!queue.TryPush(std::move(value)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < Consumers; ++c) {
+        threads.emplace_back([&]() {
+            int batch[16];
+            while (consumedCount.load() < Producers * PerProducer) {
+                size_t n = queue.TryPopBulk(batch, 16);
+                for (size_t i = 0; i < n; ++i)
+                    consumedSum.fetch_add(batch[i]);
+                consumedCount.fetch_add(static_cast<int>(n));
+                if (n == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    long long total = static_cast<long long>(Producers) * PerProducer;
+    CHECK(consumedCount.load() == total);
+    CHECK(consumedSum.load() == total * (total + 1) / 2);
+}
+
+TEST_CASE("WorkStealingQueue: grows past its initial capacity without losing items") {
+    WorkStealingQueue<int, 4> queue;
+    for (int i = 0; i < 5000; ++i)
+        queue.Push(int(i));
+    CHECK(queue.GetSize() == 5000);
+    CHECK(queue.GetCapacity() >= 5000);
+
+    auto stolen = queue.Steal();
+    REQUIRE(stolen.has_value());
+    CHECK(*stolen == 0);
+
+    for (int i = 4999; i >= 1; --i) {
+        auto item = queue.Pop();
+        REQUIRE(item.has_value());
+        CHECK(*item == i);
+    }
+    CHECK_FALSE(queue.Pop().has_value());
+    CHECK_FALSE(queue.Steal().has_value());
+}
+
+TEST_CASE("WorkStealingQueue: move-only items") {
+    WorkStealingQueue<std::unique_ptr<int>, 2> queue;
+    for (int i = 0; i < 10; ++i)
+        queue.Push(std::make_unique<int>(i));
+
+    auto last = queue.Pop();
+    REQUIRE(last.has_value());
+    CHECK(**last == 9);
+    auto first = queue.Steal();
+    REQUIRE(first.has_value());
+    CHECK(**first == 0);
+}
+
+TEST_CASE("WorkStealingQueue: every item is taken exactly once under stealing") {
+    constexpr int Items = 100000;
+    constexpr int Thieves = 3;
+
+    WorkStealingQueue<int, 64> queue;
+    std::vector<std::atomic<int>> taken(Items);
+    std::atomic<int> count{ 0 };
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < Thieves; ++t) {
+        thieves.emplace_back([&]() {
+            while (count.load() < Items) {
+                if (auto item = queue.Steal()) {
+                    taken[*item].fetch_add(1);
+                    count.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < Items; ++i) {
+        queue.Push(int(i));
+        if (i % 3 == 0) {
+            if (auto item = queue.Pop()) {
+                taken[*item].fetch_add(1);
+                count.fetch_add(1);
+            }
+        }
+    }
+    while (auto item = queue.Pop()) {
+        taken[*item].fetch_add(1);
+        count.fetch_add(1);
+    }
+    for (auto& thief : thieves)
+        thief.join();
+
+    CHECK(count.load() == Items);
+    bool allOnce = std::all_of(taken.begin(), taken.end(), [](const std::atomic<int>& n) { return n.load() == 1; });
+    CHECK(allOnce);
+}
+
+TEST_CASE("BlockingQueue: Pop parks until a producer pushes") {
+    BlockingQueue<LockFreeMPMCQueue<int, 4>> queue;
+
+    CHECK_FALSE(queue.PopFor(std::chrono::milliseconds(5)).has_value());
+
+    constexpr int Items = 10000;
+    std::thread producer([&queue]() {
+        for (int i = 1; i <= Items; ++i)
+            queue.Push(int(i)); // Blocks whenever the 4-slot ring is full
+    });
+
+    long long sum = 0;
+    for (int i = 0; i < Items; ++i)
+        sum += queue.Pop();
+    producer.join();
+
+    CHECK(sum == static_cast<long long>(Items) * (Items + 1) / 2);
+    CHECK(queue.IsEmpty());
+}
+
+TEST_CASE("BlockingQueue: PopFor returns an item pushed before the timeout") {
+    BlockingQueue<LockFreeSPSCQueue<int, 8>> queue;
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.Push(5);
+    });
+    auto item = queue.PopFor(std::chrono::seconds(5));
+    producer.join();
+    REQUIRE(item.has_value());
+    CHECK(*item == 5);
+}
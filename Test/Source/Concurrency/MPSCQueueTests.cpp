@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/MPSCQueue.h"
+#include "Core/Concurrency/MainThreadDispatcher.h"
+
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Concurrency;
+
+TEST_CASE("MPSCQueue: unbounded FIFO with move-only items") {
+    MPSCQueue<std::unique_ptr<int>> queue;
+    CHECK(queue.IsEmpty());
+    for (int i = 0; i < 5000; ++i)
+        queue.Push(std::make_unique<int>(i));
+
+    for (int i = 0; i < 5000; ++i) {
+        auto item = queue.TryPop();
+        REQUIRE(item.has_value());
+        CHECK(**item == i);
+    }
+    CHECK_FALSE(queue.TryPop().has_value());
+    CHECK(queue.IsEmpty());
+}
+
+TEST_CASE("MPSCQueue: per-producer order survives concurrent pushes") {
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 20000;
+
+    MPSCQueue<std::pair<int, int>> queue;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < Producers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < PerProducer; ++i)
+                queue.Push({ p, i });
+        });
+    }
+
+    std::vector<int> nextExpected(Producers, 0);
+    int received = 0;
+    bool ordered = true;
+    while (received < Producers * PerProducer) {
+        if (auto item = queue.TryPop()) {
+            ordered &= item->second == nextExpected[item->first]++;
+            ++received;
+        }
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    CHECK(ordered);
+    CHECK_FALSE(queue.TryPop().has_value());
+}
+
+TEST_CASE("MainThreadDispatcher: callbacks posted from workers run on the draining thread") {
+    auto& dispatcher = MainThreadDispatcher::Get();
+    dispatcher.SetMainThread();
+
+    std::thread::id ranOn;
+    int ran = 0;
+    std::thread worker([&]() {
+        dispatcher.Post([&]() { ranOn = std::this_thread::get_id(); ++ran; });
+    });
+    worker.join();
+
+    CHECK(dispatcher.GetPendingCount() == 1);
+    CHECK(dispatcher.Drain(std::chrono::milliseconds(10)) == 1);
+    CHECK(ran == 1);
+    CHECK(ranOn == std::this_thread::get_id());
+
+    dispatcher.Dispatch([&]() { ++ran; }); // Already on the main thread: runs inline
+    CHECK(ran == 2);
+}
+
+TEST_CASE("MainThreadDispatcher: drain stops once the budget is spent") {
+    auto& dispatcher = MainThreadDispatcher::Get();
+    dispatcher.SetMainThread();
+
+    for (int i = 0; i < 3; ++i)
+        dispatcher.Post([]() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+
+    CHECK(dispatcher.Drain(std::chrono::microseconds(1)) == 1);
+    CHECK(dispatcher.DrainAll() == 2);
+}
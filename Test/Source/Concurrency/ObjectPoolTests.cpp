@@ -0,0 +1,100 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/ObjectPool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Concurrency;
+
+namespace {
+    struct Tracked {
+        static inline std::atomic<int> s_Alive{ 0 };
+        int value;
+        explicit Tracked(int v) : value(v) { s_Alive.fetch_add(1); }
+        ~Tracked() { s_Alive.fetch_sub(1); }
+    };
+}
+
+TEST_CASE("ObjectPool: constructs in place and recycles released storage") {
+    ObjectPool<Tracked, 4> pool;
+
+    Tracked* a = pool.Acquire(1);
+    CHECK(a->value == 1);
+    CHECK(Tracked::s_Alive.load() == 1);
+
+    pool.Release(a);
+    CHECK(Tracked::s_Alive.load() == 0);
+
+    Tracked* b = pool.Acquire(2);
+    CHECK(b == a); // Came straight back out of this thread's magazine
+    pool.Release(b);
+
+    auto stats = pool.GetStats();
+    CHECK(stats.Hits == 1);
+    CHECK(stats.Misses == 1);
+    CHECK(stats.Live == 0);
+    CHECK(stats.HighWater == 1);
+}
+
+TEST_CASE("ObjectPool: storage grows across slabs and stays distinct") {
+    ObjectPool<int, 2, 4> pool;
+    std::vector<int*> objects;
+    for (int i = 0; i < 100; ++i)
+        objects.push_back(pool.Acquire(i));
+
+    for (int i = 0; i < 100; ++i)
+        CHECK(*objects[i] == i);
+    CHECK(pool.GetStats().Live == 100);
+
+    for (int* object : objects)
+        pool.Release(object);
+    CHECK(pool.GetStats().Live == 0);
+    CHECK(pool.GetStats().HighWater == 100);
+}
+
+TEST_CASE("ObjectPool: concurrent acquire/release across threads") {
+    constexpr int Threads = 4;
+    constexpr int Iterations = 20000;
+
+    ObjectPool<Tracked, 16, 8> pool;
+    std::atomic<bool> corrupted{ false };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t) {
+        threads.emplace_back([&pool, &corrupted, t]() {
+            std::vector<Tracked*> held;
+            for (int i = 0; i < Iterations; ++i) {
+                held.push_back(pool.Acquire(t));
+                if (held.size() > 24) {
+                    for (Tracked* object : held) {
+                        if (object->value != t)
+                            corrupted = true;
+                        pool.Release(object);
+                    }
+                    held.clear();
+                }
+            }
+            for (Tracked* object : held)
+                pool.Release(object);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK_FALSE(corrupted.load());
+    CHECK(Tracked::s_Alive.load() == 0);
+    auto stats = pool.GetStats();
+    CHECK(stats.Live == 0);
+    CHECK(stats.Hits + stats.Misses == static_cast<uint64_t>(Threads) * Iterations);
+}
+
+TEST_CASE("ObjectPool: unique handles release on scope exit") {
+    ObjectPool<Tracked> pool;
+    {
+        auto object = pool.AcquireUnique(7);
+        CHECK(object->value == 7);
+        CHECK(pool.GetStats().Live == 1);
+    }
+    CHECK(pool.GetStats().Live == 0);
+}
@@ -0,0 +1,89 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/TaskGraph.h"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace Limitless::Concurrency;
+
+TEST_CASE("TaskGraph: nodes run after their dependencies every frame") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(4);
+
+    // Diamond with a wide middle: root -> 16 leaves -> sink
+    TaskGraph graph;
+    std::atomic<int> rootRuns{ 0 }, leafRuns{ 0 };
+    std::atomic<bool> ordered{ true };
+
+    auto root = graph.AddNode("Root", [&]() { rootRuns.fetch_add(1); });
+    std::vector<TaskGraph::NodeId> leaves;
+    for (int i = 0; i < 16; ++i) {
+        leaves.push_back(graph.AddNode("Leaf", [&]() {
+            if (leafRuns.load() / 16 >= rootRuns.load())
+                ordered = false;
+            leafRuns.fetch_add(1);
+        }, { root }));
+    }
+    auto sink = graph.AddNode("Sink", [&]() {
+        if (leafRuns.load() != rootRuns.load() * 16)
+            ordered = false;
+    });
+    for (auto leaf : leaves)
+        graph.AddDependency(sink, leaf);
+
+    for (int frame = 0; frame < 100; ++frame)
+        graph.Execute();
+
+    CHECK(graph.IsCompiled());
+    CHECK(rootRuns.load() == 100);
+    CHECK(leafRuns.load() == 1600);
+    CHECK(ordered.load());
+
+    jobs.Shutdown();
+}
+
+TEST_CASE("TaskGraph: the longest path is prioritised and exported with timings") {
+    TaskGraph graph;
+    auto slow = graph.AddNode("Slow", []() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    auto fast = graph.AddNode("Fast", []() {});
+    auto tail = graph.AddNode("Tail", []() {}, { slow });
+
+    graph.Execute(); // First run measures durations
+    graph.Execute();
+
+    auto trace = graph.ExportTrace();
+    REQUIRE(trace["traceEvents"].is_array());
+
+    int64_t slowPriority = 0, fastPriority = 0;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] != "X")
+            continue;
+        if (event["name"] == "Slow") {
+            slowPriority = event["args"]["priority"];
+            CHECK(event["dur"].get<int64_t>() >= 2000);
+        }
+        if (event["name"] == "Fast")
+            fastPriority = event["args"]["priority"];
+        if (event["name"] == "Tail")
+            CHECK(event["args"]["dependencies"][0] == "Slow");
+    }
+    CHECK(slowPriority > fastPriority);
+
+    // Without workers everything runs on the caller, most critical first
+    CHECK(graph.GetTiming(slow).Start <= graph.GetTiming(fast).Start);
+    CHECK(graph.GetTiming(tail).Worker == -1);
+}
+
+TEST_CASE("TaskGraph: cycles are rejected at compile time") {
+    TaskGraph graph;
+    auto a = graph.AddNode("A", []() {});
+    auto b = graph.AddNode("B", []() {}, { a });
+    graph.AddDependency(a, b);
+
+    CHECK_THROWS_AS(graph.Compile(), std::runtime_error);
+    CHECK_FALSE(graph.IsCompiled());
+}
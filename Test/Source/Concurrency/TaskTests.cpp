@@ -0,0 +1,102 @@
+#include <doctest/doctest.h>
+
+#include "Core/Concurrency/Task.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace Limitless::Concurrency;
+
+namespace {
+    Task<int> Add(int a, int b) {
+        co_return a + b;
+    }
+
+    Task<int> Sum(int count) {
+        int total = 0;
+        for (int i = 0; i < count; ++i)
+            total += co_await Add(i, 1);
+        co_return total;
+    }
+
+    Task<std::string> Fail() {
+        throw std::runtime_error("load failed");
+        co_return std::string();
+    }
+
+    Task<int> SumOnWorkers(int jobCount) {
+        co_await ResumeOnWorker();
+
+        std::atomic<int> sum{ 0 };
+        JobCounter counter;
+        for (int i = 0; i < jobCount; ++i)
+            JobSystem::Get().Run([&sum]() { sum.fetch_add(1, std::memory_order_relaxed); }, &counter);
+
+        co_await WaitForCounter(counter);
+        co_return sum.load();
+    }
+}
+
+TEST_CASE("Task: nested awaits propagate results and exceptions") {
+    CHECK(SyncWait(Sum(1000)) == 1000 * 1001 / 2);
+    CHECK_THROWS_AS(SyncWait(Fail()), std::runtime_error);
+
+    Task<int> lazy = Add(2, 3);
+    CHECK_FALSE(lazy.IsDone()); // Nothing runs until awaited
+    CHECK(SyncWait(std::move(lazy)) == 5);
+}
+
+TEST_CASE("Task: waits on a job counter from the worker pool") {
+    auto& jobs = JobSystem::Get();
+    jobs.Initialize(4);
+
+    for (int round = 0; round < 50; ++round)
+        CHECK(SyncWait(SumOnWorkers(64)) == 64);
+
+    jobs.Shutdown();
+}
+
+TEST_CASE("Task: hops between workers, the main thread and frames") {
+    auto& jobs = JobSystem::Get();
+    auto& dispatcher = MainThreadDispatcher::Get();
+    jobs.Initialize(4);
+    dispatcher.SetMainThread();
+
+    int frame = 0;
+    std::atomic<bool> done{ false };
+    int workerIndex = -2;
+    bool resumedOnMain = false;
+    int resumedFrame = -1;
+
+    // Named so the captures outlive the coroutine
+    auto sequence = [&]() -> Task<void> {
+        co_await ResumeOnWorker();
+        workerIndex = JobSystem::GetCurrentWorkerIndex();
+
+        co_await ResumeOnMainThread();
+        resumedOnMain = dispatcher.IsMainThread();
+        int startFrame = frame;
+
+        co_await NextFrame();
+        resumedFrame = frame - startFrame;
+        done.store(true);
+    };
+    Spawn(sequence());
+
+    // Stand-in for Application::Run's loop
+    while (!done.load() && frame < 100000) {
+        ++frame;
+        dispatcher.BeginFrame();
+        dispatcher.DrainFrame();
+        std::this_thread::yield();
+    }
+
+    CHECK(done.load());
+    CHECK(workerIndex >= 0);
+    CHECK(resumedOnMain);
+    CHECK(resumedFrame == 1);
+
+    jobs.Shutdown();
+}
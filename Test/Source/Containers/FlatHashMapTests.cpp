@@ -0,0 +1,107 @@
+#include <doctest/doctest.h>
+
+#include "Core/Containers/FlatHashMap.h"
+
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace Limitless::Containers;
+
+TEST_CASE("FlatHashMap: insert, find, overwrite and erase") {
+    FlatHashMap<std::string, int> map;
+    CHECK(map.Find("missing") == map.end());
+
+    CHECK(map.TryEmplace("one", 1).second);
+    CHECK_FALSE(map.TryEmplace("one", 100).second);
+    map["two"] = 2;
+    map.InsertOrAssign("three", 3);
+    map.InsertOrAssign("three", 33);
+
+    CHECK(map.Size() == 3);
+    CHECK(map.Find("one")->second == 1);
+    CHECK(*map.TryGet("three") == 33);
+    CHECK(map.Contains("two"));
+
+    CHECK(map.Erase("two"));
+    CHECK_FALSE(map.Erase("two"));
+    CHECK_FALSE(map.Contains("two"));
+    CHECK(map.Size() == 2);
+
+    int sum = 0;
+    for (const auto& [key, value] : map)
+        sum += value;
+    CHECK(sum == 34);
+
+    map.Clear();
+    CHECK(map.Empty());
+    CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("FlatHashMap: matches std::unordered_map under random churn") {
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    std::mt19937_64 random(42);
+
+    bool consistent = true;
+    for (int step = 0; step < 200000; ++step) {
+        uint64_t key = random() % 5000;
+        switch (random() % 3) {
+            case 0:
+                map[key] = step;
+                reference[key] = step;
+                break;
+            case 1:
+                consistent &= map.Erase(key) == (reference.erase(key) == 1);
+                break;
+            default: {
+                auto it = reference.find(key);
+                const uint64_t* found = map.TryGet(key);
+                consistent &= (found != nullptr) == (it != reference.end());
+                if (found && it != reference.end())
+                    consistent &= *found == it->second;
+            }
+        }
+    }
+    CHECK(consistent);
+    CHECK(map.Size() == reference.size());
+    CHECK(map.LoadFactor() <= 0.875f);
+
+    size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        consistent &= reference.at(key) == value;
+        ++visited;
+    }
+    CHECK(consistent);
+    CHECK(visited == reference.size());
+}
+
+TEST_CASE("FlatHashMap: erase while iterating, copies, moves and pmr resources") {
+    std::pmr::monotonic_buffer_resource arena;
+    FlatHashMap<int, std::unique_ptr<int>> owners(&arena);
+    for (int i = 0; i < 100; ++i)
+        owners.TryEmplace(i, std::make_unique<int>(i));
+
+    for (auto it = owners.begin(); it != owners.end();) {
+        if (it->first % 2 == 0)
+            it = owners.Erase(it);
+        else
+            ++it;
+    }
+    CHECK(owners.Size() == 50);
+    CHECK(*owners[51] == 51);
+    CHECK(owners.GetResource() == &arena);
+
+    FlatHashMap<int, std::unique_ptr<int>> moved(std::move(owners));
+    CHECK(moved.Size() == 50);
+    CHECK(owners.Empty());
+
+    FlatHashMap<int, std::string> names{ { 1, "one" }, { 2, "two" } };
+    FlatHashMap<int, std::string> copy = names;
+    copy[1] = "uno";
+    CHECK(names[1] == "one");
+    CHECK(copy[1] == "uno");
+    CHECK(copy.Size() == 2);
+}
@@ -0,0 +1,126 @@
+#include <doctest/doctest.h>
+
+#include "Core/Containers/HandlePool.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace Limitless::Containers;
+
+TEST_CASE("HandlePool: handles resolve until destroyed and stay stale after slot reuse") {
+    HandlePool<std::string> pool;
+    CHECK(pool.Get(Handle<std::string>{}) == nullptr);
+
+    auto a = pool.Create("alpha");
+    auto b = pool.Create("beta");
+    auto c = pool.Create("gamma");
+    CHECK(pool.Size() == 3);
+    CHECK(*pool.Get(b) == "beta");
+
+    CHECK(pool.Destroy(a));
+    CHECK_FALSE(pool.Destroy(a));
+    CHECK_FALSE(pool.IsValid(a));
+    CHECK(pool.Get(a) == nullptr);
+
+    // The last value was swapped into the hole; its handle still resolves
+    CHECK(pool[c] == "gamma");
+    CHECK(pool[b] == "beta");
+
+    // a's slot is recycled under a new generation
+    auto d = pool.Create("delta");
+    CHECK(d.Index == a.Index);
+    CHECK(d.Generation != a.Generation);
+    CHECK(pool.Get(a) == nullptr);
+    CHECK(pool[d] == "delta");
+    CHECK(pool.Capacity() == 3);
+
+    pool.Clear();
+    CHECK(pool.Empty());
+    CHECK_FALSE(pool.IsValid(b));
+    CHECK_FALSE(pool.IsValid(d));
+}
+
+TEST_CASE("HandlePool: storage stays dense under churn") {
+    HandlePool<int> pool;
+    std::vector<Handle<int>> live;
+    for (int i = 0; i < 1000; ++i)
+        live.push_back(pool.Create(i));
+
+    // Destroy every other value
+    std::vector<Handle<int>> kept;
+    for (size_t i = 0; i < live.size(); ++i) {
+        if (i % 2 == 0)
+            pool.Destroy(live[i]);
+        else
+            kept.push_back(live[i]);
+    }
+    REQUIRE(pool.Size() == kept.size());
+
+    bool resolved = true;
+    for (auto handle : kept)
+        resolved &= pool[handle] % 2 == 1;
+    CHECK(resolved);
+
+    // Dense iteration and ForEach see exactly the live values, with matching handles
+    int sum = 0;
+    for (int value : pool)
+        sum += value;
+    int expected = 0;
+    for (int i = 1; i < 1000; i += 2)
+        expected += i;
+    CHECK(sum == expected);
+
+    std::unordered_set<Handle<int>> seen;
+    bool consistent = true;
+    pool.ForEach([&](Handle<int> handle, int& value) {
+        consistent &= pool.Get(handle) == &value;
+        seen.insert(handle);
+    });
+    CHECK(consistent);
+    CHECK(seen.size() == kept.size());
+}
+
+TEST_CASE("HandlePool: values are destroyed with their handle") {
+    HandlePool<std::shared_ptr<int>> pool;
+    auto value = std::make_shared<int>(7);
+
+    auto first = pool.Create(value);
+    auto second = pool.Create(value);
+    CHECK(value.use_count() == 3);
+
+    CHECK(pool.Destroy(first));
+    CHECK(value.use_count() == 2);
+    CHECK(**pool.Get(second) == 7);
+
+    pool.Clear();
+    CHECK(value.use_count() == 1);
+}
+
+TEST_CASE("HandlePool: a throwing constructor leaves the pool consistent") {
+    struct Fussy {
+        int Value;
+        explicit Fussy(int value) : Value(value) {
+            if (value < 0)
+                throw std::runtime_error("negative");
+        }
+    };
+
+    HandlePool<Fussy> pool;
+    std::vector<HandlePool<Fussy>::HandleType> handles;
+    for (int i = 0; i < 20; ++i) {
+        handles.push_back(pool.Create(i));
+        CHECK_THROWS_AS(pool.Create(-1), std::runtime_error);
+    }
+    CHECK(pool.Size() == 20);
+
+    // Destroy swaps through the dense arrays, which would be out of step after a half-finished Create
+    for (size_t i = 0; i < handles.size(); i += 2)
+        CHECK(pool.Destroy(handles[i]));
+    CHECK_THROWS_AS(pool.Create(-1), std::runtime_error);
+    CHECK(pool.Size() == 10);
+    for (size_t i = 1; i < handles.size(); i += 2)
+        CHECK(pool.Get(handles[i])->Value == static_cast<int>(i));
+}
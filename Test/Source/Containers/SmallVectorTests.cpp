@@ -0,0 +1,76 @@
+#include <doctest/doctest.h>
+
+#include "Core/Containers/FixedVector.h"
+#include "Core/Containers/SmallVector.h"
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+using namespace Limitless::Containers;
+
+TEST_CASE("SmallVector: stays inline up to N, then spills to its resource") {
+    std::pmr::monotonic_buffer_resource arena;
+    SmallVector<std::string, 4> names(&arena);
+    for (int i = 0; i < 4; ++i)
+        names.EmplaceBack("name " + std::to_string(i));
+    CHECK(names.IsInline());
+
+    // Pushing an element of itself across the spill must not read a moved-from value
+    names.PushBack(names[0]);
+    CHECK_FALSE(names.IsInline());
+    CHECK(names.Size() == 5);
+    CHECK(names.Back() == "name 0");
+    CHECK(names[3] == "name 3");
+
+    names.Erase(names.begin() + 1);
+    CHECK(names[1] == "name 2");
+    names.SwapErase(0);
+    CHECK(names[0] == "name 0");
+    CHECK(names.Size() == 3);
+
+    SmallVector<std::string, 4> moved(std::move(names));
+    CHECK(moved.Size() == 3);
+    CHECK(names.Empty());
+    CHECK(names.IsInline());
+
+    SmallVector<std::string, 4> copy = moved;
+    copy.Resize(1);
+    CHECK(copy.Size() == 1);
+    CHECK(moved.Size() == 3);
+}
+
+TEST_CASE("SmallVector: inline moves and destruction") {
+    auto shared = std::make_shared<int>(1);
+    {
+        SmallVector<std::shared_ptr<int>, 2> small{ shared, shared };
+        SmallVector<std::shared_ptr<int>, 2> other;
+        other = std::move(small);
+        CHECK(other.IsInline());
+        CHECK(other.Size() == 2);
+        CHECK(shared.use_count() == 3);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE("FixedVector: bounded inline storage") {
+    FixedVector<int, 3> values{ 1, 2 };
+    values.PushBack(3);
+    CHECK(values.Full());
+    CHECK(values.TryEmplaceBack(4) == nullptr);
+
+    int sum = 0;
+    for (int value : values)
+        sum += value;
+    CHECK(sum == 6);
+
+    values.Erase(values.begin());
+    CHECK(values[0] == 2);
+    values.Resize(3);
+    CHECK(values[2] == 0);
+
+    FixedVector<int, 3> copy = values;
+    copy.Clear();
+    CHECK(copy.Empty());
+    CHECK(values.Size() == 3);
+}
@@ -0,0 +1,173 @@
+#include <doctest/doctest.h>
+
+#include "CapturedLog.h"
+#include "Core/Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+    int s_Evaluations = 0;
+    int Counted() { return ++s_Evaluations; }
+}
+
+TEST_CASE("Log: category macros prefix the category and honour its runtime level") {
+    CapturedLog capture;
+    REQUIRE(Log::GetCategoryLevel(LogCategory::Renderer) == LogLevel::Trace);
+
+    LM_LOG_CAT_INFO(Renderer, "frame {}", 1);
+    LM_LOG_CAT_WARN(Assets, "missing texture");
+
+    Log::SetCategoryLevel(LogCategory::Renderer, LogLevel::Warn);
+    s_Evaluations = 0;
+    LM_LOG_CAT_INFO(Renderer, "filtered {}", Counted());
+    LM_LOG_CAT_ERROR(Renderer, "device lost {}", Counted());
+    Log::SetCategoryLevel(LogCategory::Renderer, LogLevel::Trace);
+
+    // Arguments of filtered calls are never evaluated
+    CHECK(s_Evaluations == 1);
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 3);
+    CHECK(lines[0].find("[Renderer] frame 1") == 0);
+    CHECK(lines[1].find("[Assets] missing texture") == 0);
+    CHECK(lines[2].find("[Renderer] device lost 1") == 0);
+    CHECK(std::string(ToString(LogCategory::Concurrency)) == "Concurrency");
+}
+
+TEST_CASE("Log: identical consecutive messages from a call site are collapsed") {
+    CapturedLog capture;
+    CHECK_FALSE(Log::GetSuppressDuplicates());  // Only Log::Init, which runs the reporter, turns it on
+    Log::SetSuppressDuplicates(true);
+
+    for (int i = 0; i < 6; ++i)
+        LM_CORE_LOG_WARN("texture {} missing", i < 5 ? 1 : 2);
+    for (int i = 0; i < 3; ++i)
+        LM_CORE_LOG_WARN("shader missing");
+    Log::FlushRepeatedMessages();
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 5);
+    CHECK(lines[0].find("texture 1 missing") == 0);
+    CHECK(lines[1].find("Previous message repeated 4 more times: \"texture 1 missing\"") == 0);
+    CHECK(lines[2].find("texture 2 missing") == 0);
+    CHECK(lines[3].find("shader missing") == 0);
+    CHECK(lines[4].find("Previous message repeated 2 more times: \"shader missing\"") == 0);
+
+    Log::SetSuppressDuplicates(false);
+    for (int i = 0; i < 3; ++i)
+        LM_CORE_LOG_WARN("unsuppressed");
+    CHECK(capture.Sink->last_formatted().size() == 8);
+}
+
+TEST_CASE("Log: a flush ends the suppression window") {
+    CapturedLog capture;
+    Log::SetSuppressDuplicates(true);
+
+    const std::string longText(200, 'a');
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < 3; ++i)
+            LM_CORE_LOG_INFO("JobSystem started with {} workers", 4);
+        Log::FlushRepeatedMessages();
+    }
+    // A message with no repeats is still written again after the window closes
+    LM_CORE_LOG_INFO("resized");
+    Log::FlushRepeatedMessages();
+    LM_CORE_LOG_INFO("resized");
+    for (int i = 0; i < 2; ++i)
+        LM_CORE_LOG_INFO("{}", longText);
+    Log::FlushRepeatedMessages();
+    Log::SetSuppressDuplicates(false);
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 8);
+    CHECK(lines[0].find("JobSystem started with 4 workers") == 0);
+    CHECK(lines[1].find("Previous message repeated 2 more times: \"JobSystem started") == 0);
+    CHECK(lines[2].find("JobSystem started with 4 workers") == 0);
+    CHECK(lines[3].find("Previous message repeated 2 more times") == 0);
+    CHECK(lines[4].find("resized") == 0);
+    CHECK(lines[5].find("resized") == 0);
+    CHECK(lines[6].find(longText) == 0);
+    CHECK(lines[7].find("Previous message repeated 1 more times: \"" + std::string(LogCallSite::TextCapacity, 'a') + "...\"") == 0);
+}
+
+TEST_CASE("Log: repeats from many threads are all logged or counted") {
+    constexpr int ThreadCount = 4;
+    constexpr int PerThread = 5000;
+    CapturedLog capture(ThreadCount * PerThread);
+    Log::SetSuppressDuplicates(true);
+
+    // One call site shared by every thread, with a flusher ending runs underneath them
+    std::atomic<bool> done{ false };
+    std::thread flusher([&done]() {
+        while (!done.load())
+            Log::FlushRepeatedMessages();
+    });
+    std::vector<std::thread> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < PerThread; ++i)
+                LM_CORE_LOG_INFO("heartbeat {}", i % 64 < 60 ? 0 : 1);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    done = true;
+    flusher.join();
+    Log::FlushRepeatedMessages();
+    Log::SetSuppressDuplicates(false);
+
+    size_t accounted = 0;
+    for (const auto& line : capture.Sink->last_formatted()) {
+        if (line.rfind("Previous message repeated ", 0) == 0)
+            accounted += std::stoul(line.substr(26));
+        else
+            ++accounted;
+    }
+    CHECK(accounted == ThreadCount * PerThread);
+}
+
+TEST_CASE("Log: throttled macros skip calls without evaluating their arguments") {
+    CapturedLog capture;
+    s_Evaluations = 0;
+
+    for (int i = 0; i < 10; ++i)
+        LM_CORE_LOG_INFO_EVERY_N(4, "every {}", Counted());
+    CHECK(s_Evaluations == 3);
+
+    for (int i = 0; i < 10; ++i)
+        LM_LOG_WARN_ONCE("once {}", Counted());
+    CHECK(s_Evaluations == 4);
+
+    for (int i = 0; i < 10; ++i)
+        LM_CORE_LOG_ERROR_RATE(2.0, "rate {}", Counted());
+    CHECK(s_Evaluations == 6);
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 6);
+    CHECK(lines[0].find("every 1") == 0);
+    CHECK(lines[2].find("every 3") == 0);
+    CHECK(lines[3].find("once 4") == 0);
+    CHECK(lines[5].find("rate 6") == 0);
+}
+
+TEST_CASE("Log: rate limiter admits a one second burst and counts what it rejects") {
+    LogRateLimiter limiter;
+    uint32_t suppressed = 0;
+    int admitted = 0;
+    for (int i = 0; i < 150; ++i)
+        admitted += limiter.TryAcquire(100.0, suppressed) ? 1 : 0;
+    CHECK(admitted >= 100);
+    CHECK(admitted < 150);
+    CHECK(suppressed == 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    REQUIRE(limiter.TryAcquire(100.0, suppressed));
+    CHECK(suppressed == static_cast<uint32_t>(150 - admitted));
+    CHECK_FALSE(limiter.TryAcquire(0.0, suppressed));
+}
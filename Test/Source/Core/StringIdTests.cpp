@@ -0,0 +1,65 @@
+#include <doctest/doctest.h>
+
+#include "Core/StringId.h"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+    // Literal ids are usable as case labels
+    int Classify(StringId id) {
+        switch (id.GetHash()) {
+            case "player"_sid.GetHash(): return 1;
+            case "enemy"_sid.GetHash():  return 2;
+            default:                     return 0;
+        }
+    }
+}
+
+TEST_CASE("StringId: compile-time and runtime hashes agree") {
+    static_assert(StringId::Hash("") == StringId::OffsetBasis);
+    static_assert(StringId::Hash("a") == 0xaf63dc4c8601ec8cull);   // FNV-1a 64 reference value
+    static_assert("player"_sid != "enemy"_sid);
+
+    std::string name = "play";
+    name += "er";
+    CHECK(StringId(name) == "player"_sid);
+    CHECK(Classify(StringId::Intern("enemy")) == 2);
+    CHECK(Classify(StringId::Intern("npc")) == 0);
+
+    std::unordered_map<StringId, int> scores{ { "player"_sid, 10 } };
+    CHECK(scores.at(StringId(name)) == 10);
+}
+
+TEST_CASE("StringId: interned ids reverse-look-up their string") {
+    StringId id = StringId::Intern("assets/textures/grass.png");
+    CHECK(id.GetString() == "assets/textures/grass.png");
+    CHECK(id.ToString() == "assets/textures/grass.png");
+    CHECK(fmt::format("{}", id) == "assets/textures/grass.png");
+
+    StringId unknown(0x1234ull);
+    CHECK(unknown.GetString().empty());
+    CHECK(unknown.ToString() == "#0000000000001234");
+}
+
+TEST_CASE("StringId: concurrent interning records each string once") {
+    const size_t before = StringId::GetInternedCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 1000; ++i)
+                StringId::Intern("concurrent_" + std::to_string(i));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(StringId::GetInternedCount() == before + 1000);
+    CHECK(StringId::GetCollisionCount() == 0);
+    CHECK(StringId::Intern("concurrent_500").GetString() == "concurrent_500");
+}
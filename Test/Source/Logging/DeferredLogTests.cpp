@@ -0,0 +1,229 @@
+#include <doctest/doctest.h>
+
+#include "CapturedLog.h"
+#include "Core/Logging/DeferredLog.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Limitless;
+using namespace Limitless::Logging;
+
+namespace {
+    // Binary log records assembled in memory, so a test can append damage after good records
+    struct BinaryLogBytes {
+        std::string Data;
+        template<typename T>
+        BinaryLogBytes& Put(T value) {
+            Data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            return *this;
+        }
+        BinaryLogBytes& Site(uint32_t id, const std::string& format, uint32_t fileLength = 8) {
+            Put(static_cast<uint8_t>(BinaryLogFormat::RecordKind::Site)).Put(id);
+            Put(static_cast<uint8_t>(LogLevel::Info)).Put(static_cast<uint8_t>(LogCategory::Core));
+            Put(uint32_t{ 7 }).Put(uint16_t{ 0 }).Put(fileLength);
+            Data.append("test.cpp");
+            Put(static_cast<uint32_t>(format.size()));
+            Data.append(format);
+            return *this;
+        }
+        BinaryLogBytes& Event(uint32_t siteId, uint32_t payloadSize = 0) {
+            Put(static_cast<uint8_t>(BinaryLogFormat::RecordKind::Event)).Put(siteId);
+            return Put(uint64_t{ 1 }).Put(uint64_t{ 2 }).Put(payloadSize);
+        }
+    };
+
+    // Stops the backend even when a check fails
+    struct RunningBackend {
+        RunningBackend() { DeferredLog::Start(); }
+        explicit RunningBackend(const DeferredLog::Config& config) { DeferredLog::Start(config); }
+        ~RunningBackend() { DeferredLog::Stop(); }
+    };
+}
+
+TEST_CASE("DeferredLog: formats on the backend in call order") {
+    CapturedLog capture;
+    RunningBackend backend;
+
+    std::string name = "albedo";
+    LM_LOG_FAST_INFO(Renderer, "loaded {} ({} KiB, {:.1f} ms)", name, 512u, 1.25f);
+    name = "overwritten";  // Strings are copied at the call site
+    LM_LOG_FAST_WARN(Assets, "{} {} {} {}", true, 'x', -7, "literal");
+    DeferredLog::Flush();
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0].find("[Renderer] loaded albedo (512 KiB, 1.2 ms)") == 0);
+    CHECK(lines[1].find("[Assets] true x -7 literal") == 0);
+    CHECK(DeferredLog::GetStats().Records >= 2);
+}
+
+TEST_CASE("DeferredLog: category level filters before capture and stopped backend logs immediately") {
+    CapturedLog capture;
+    {
+        RunningBackend backend;
+        Log::SetCategoryLevel(LogCategory::Audio, LogLevel::Error);
+        LM_LOG_FAST_INFO(Audio, "filtered");
+        Log::SetCategoryLevel(LogCategory::Audio, LogLevel::Trace);
+        LM_LOG_FAST_INFO(Audio, "kept");
+        DeferredLog::Flush();
+    }
+
+    REQUIRE_FALSE(DeferredLog::IsRunning());
+    LM_LOG_FAST_ERROR(Core, "direct {}", 42);
+
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0].find("[Audio] kept") == 0);
+    CHECK(lines[1].find("[Core] direct 42") == 0);
+}
+
+TEST_CASE("DeferredLog: records from many threads are all delivered") {
+    constexpr int ThreadCount = 4;
+    constexpr int PerThread = 2000;
+
+    CapturedLog capture(ThreadCount * PerThread);
+    DeferredLog::Config config;
+    config.RingBytesPerThread = 4096;  // Small enough that producers have to wait on the backend
+    config.Overflow = LogOverflowPolicy::Block;
+    RunningBackend backend(config);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < PerThread; ++i)
+                LM_LOG_FAST_DEBUG(Concurrency, "{} {}", t, i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    DeferredLog::Flush();
+
+    // Per-thread order survives the merge
+    std::vector<int> next(ThreadCount, 0);
+    auto lines = capture.Sink->last_formatted();
+    REQUIRE(lines.size() == ThreadCount * PerThread);
+    for (const auto& line : lines) {
+        int thread = -1, index = -1;
+        REQUIRE(std::sscanf(line.c_str(), "[Concurrency] %d %d", &thread, &index) == 2);
+        CHECK(index == next[thread]++);
+    }
+}
+
+TEST_CASE("DeferredLog: a full ring drops records instead of blocking and counts them") {
+    constexpr int Total = 20000;
+
+    CapturedLog capture(Total);
+    const uint64_t droppedBefore = Log::GetDroppedCount();
+    {
+        DeferredLog::Config config;
+        config.RingBytesPerThread = 1024;
+        config.Overflow = LogOverflowPolicy::DropNewest;
+        RunningBackend backend(config);
+
+        const uint64_t blockedBefore = DeferredLog::GetStats().Blocked;
+        for (int i = 0; i < Total; ++i)
+            LM_LOG_FAST_TRACE(Core, "burst {}", i);
+        DeferredLog::Flush();
+        CHECK(DeferredLog::GetStats().Blocked == blockedBefore);
+    }
+
+    const uint64_t dropped = Log::GetDroppedCount() - droppedBefore;
+    CHECK(dropped > 0);
+    CHECK(capture.Sink->last_formatted().size() + dropped == Total);
+}
+
+TEST_CASE("DeferredLog: binary file round-trips through BinaryLogReader") {
+    CapturedLog capture;
+    const auto path = std::filesystem::temp_directory_path() / "lm_deferred_log_test.lmlog";
+
+    {
+        DeferredLog::Config config;
+        config.FormatToSinks = false;
+        config.BinaryFile = path;
+        RunningBackend backend(config);
+
+        for (int i = 0; i < 3; ++i)
+            LM_LOG_FAST_INFO(Memory, "pool {} at {:.2f}%", i, 12.5 * i);
+        LM_LOG_FAST_ERROR(Platform, "window '{}' lost", std::string("main"));
+    }
+    CHECK(capture.Sink->last_formatted().empty());
+
+    BinaryLogReader reader(path);
+    REQUIRE(reader.IsOpen());
+
+    std::vector<BinaryLogReader::Entry> entries;
+    BinaryLogReader::Entry entry;
+    while (reader.Next(entry))
+        entries.push_back(entry);
+
+    REQUIRE(entries.size() == 4);
+    CHECK(entries[0].Message == "pool 0 at 0.00%");
+    CHECK(entries[2].Message == "pool 2 at 25.00%");
+    CHECK(entries[2].Category == LogCategory::Memory);
+    CHECK(entries[3].Message == "window 'main' lost");
+    CHECK(entries[3].Level == LogLevel::Error);
+    CHECK(entries[3].File.find("DeferredLogTests.cpp") != std::string_view::npos);
+    CHECK(entries[0].TimestampNs <= entries[3].TimestampNs);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("BinaryLogReader: corrupted records stop the reader with an error") {
+    BinaryLogBytes good;
+    good.Data.append(BinaryLogFormat::Magic, sizeof(BinaryLogFormat::Magic));
+    good.Put(BinaryLogFormat::Version).Put(uint32_t{ 0 });
+    good.Site(3, "before the damage").Event(3);
+
+    const auto path = std::filesystem::temp_directory_path() / "lm_corrupted_log_test.lmlog";
+    auto read = [&path](const BinaryLogBytes& bytes, size_t& events) {
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(bytes.Data.data(), static_cast<std::streamsize>(bytes.Data.size()));
+        }
+        BinaryLogReader reader(path);
+        REQUIRE(reader.IsOpen());
+        BinaryLogReader::Entry entry;
+        for (events = 0; reader.Next(entry); ++events)
+            CHECK(entry.Message == "before the damage");
+        CHECK_FALSE(reader.Next(entry));
+        return reader.GetError();
+    };
+
+    struct Damage {
+        const char* Name;
+        BinaryLogBytes Tail;
+    };
+    std::vector<Damage> damaged;
+    damaged.push_back({ "site id + 1 wraps to 0", BinaryLogBytes{}.Site(std::numeric_limits<uint32_t>::max(), "x") });
+    damaged.push_back({ "site id 0 is never assigned", BinaryLogBytes{}.Site(0, "x") });
+    damaged.push_back({ "file name length", BinaryLogBytes{}.Site(4, "x", 1u << 30) });
+    damaged.push_back({ "unknown record kind", BinaryLogBytes{}.Put(uint8_t{ 9 }) });
+    damaged.push_back({ "event before its site", BinaryLogBytes{}.Event(5) });
+    damaged.push_back({ "payload size", BinaryLogBytes{}.Event(3, 1u << 30) });
+
+    for (const Damage& damage : damaged) {
+        CAPTURE(damage.Name);
+        BinaryLogBytes bytes = good;
+        bytes.Data += damage.Tail.Data;
+        size_t events = 0;
+        const std::string error = read(bytes, events);
+        CHECK(events == 1);
+        CHECK(error.find("corrupted") == 0);
+    }
+
+    // A record cut short by a crash is the normal end of the file, not an error
+    BinaryLogBytes truncated = good;
+    truncated.Event(3, 64);
+    truncated.Data.append("partial");
+    size_t events = 0;
+    CHECK(read(truncated, events).empty());
+    CHECK(events == 1);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,186 @@
+#include <doctest/doctest.h>
+
+#include "Core/Log.h"
+#include "Core/Logging/DeferredLog.h"
+#include "Core/Logging/FlightRecorderSink.h"
+
+#include <spdlog/logger.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if !defined(_WIN32)
+    #include <csignal>
+    #include <sys/resource.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+using namespace Limitless;
+using namespace Limitless::Logging;
+
+namespace {
+    std::filesystem::path TestFile(const char* name) {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove(path);
+        auto previous = path;
+        previous += ".prev";
+        std::filesystem::remove(previous);
+        return path;
+    }
+}
+
+TEST_CASE("FlightRecorderSink: records are recoverable without flushing") {
+    const auto path = TestFile("lm_flight_test.flight");
+
+    auto sink = std::make_shared<FlightRecorderSink>(path, 64 * 1024);
+    sink->set_pattern("%l %v");
+    spdlog::logger logger("flight", sink);
+    logger.set_level(spdlog::level::trace);
+    logger.trace("first {}", 1);
+    logger.error("second");
+
+    // Read while the sink is still mapped: the file is the mapping, so nothing has to be flushed
+    FlightRecording recording;
+    std::string error;
+    REQUIRE(RecoverFlightRecording(path, recording, error));
+    REQUIRE(recording.Records.size() == 2);
+    CHECK(recording.Records[0].Text == "trace first 1\n");
+    CHECK(recording.Records[0].Level == LogLevel::Trace);
+    CHECK(recording.Records[1].Text == "error second\n");
+    CHECK(recording.Records[1].Sequence == 2);
+    CHECK(recording.LostRecords == 0);
+    CHECK(recording.ProcessId != 0);
+}
+
+TEST_CASE("FlightRecorderSink: the ring keeps the newest records and the previous run is kept") {
+    const auto path = TestFile("lm_flight_ring_test.flight");
+    constexpr int Total = 2000;
+
+    {
+        auto sink = std::make_shared<FlightRecorderSink>(path, 4096);
+        sink->set_pattern("%v");
+        spdlog::logger logger("flight", sink);
+        for (int i = 0; i < Total; ++i)
+            logger.info("record {}", i);
+    }
+
+    FlightRecording recording;
+    std::string error;
+    REQUIRE(RecoverFlightRecording(path, recording, error));
+    REQUIRE(!recording.Records.empty());
+    CHECK(recording.Records.size() < Total);
+    CHECK(recording.Records.back().Text == "record " + std::to_string(Total - 1) + "\n");
+    CHECK(recording.Records.size() + recording.LostRecords == Total);
+
+    // The newest records form an unbroken run
+    for (size_t i = 1; i < recording.Records.size(); ++i)
+        CHECK(recording.Records[i].Sequence > recording.Records[i - 1].Sequence);
+    const size_t tail = recording.Records.size() / 2;
+    CHECK(recording.Records.back().Sequence - recording.Records[tail].Sequence == recording.Records.size() - 1 - tail);
+
+    // Starting again moves the old ring aside instead of overwriting it
+    { FlightRecorderSink again(path, 4096); }
+    auto previous = path;
+    previous += ".prev";
+    FlightRecording old;
+    REQUIRE(RecoverFlightRecording(previous, old, error));
+    CHECK(old.Records.size() == recording.Records.size());
+
+    CHECK_FALSE(RecoverFlightRecording(std::filesystem::temp_directory_path() / "lm_missing.flight", old, error));
+    CHECK(!error.empty());
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(previous);
+}
+
+TEST_CASE("FlightRecorderSink: a corrupted header is bounded by the file size") {
+    const auto path = TestFile("lm_flight_header_test.flight");
+    {
+        auto sink = std::make_shared<FlightRecorderSink>(path, 4096);
+        sink->set_pattern("%v");
+        spdlog::logger logger("flight", sink);
+        logger.info("kept");
+    }
+
+    auto patch = [&path](size_t offset, auto value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    // A capacity far past the file no longer sizes the allocation; the records present are still recovered
+    patch(offsetof(FlightRecorderFormat::FileHeader, Capacity), uint64_t{ 1 } << 62);
+    FlightRecording recording;
+    std::string error;
+    REQUIRE_MESSAGE(RecoverFlightRecording(path, recording, error), error);
+    REQUIRE(recording.Records.size() == 1);
+    CHECK(recording.Records[0].Text == "kept\n");
+
+    // A header claiming to end past the file is rejected
+    patch(offsetof(FlightRecorderFormat::FileHeader, HeaderSize), uint32_t{ 0xffffffff });
+    error.clear();
+    CHECK_FALSE(RecoverFlightRecording(path, recording, error));
+    CHECK(error.find("corrupted header") != std::string::npos);
+
+    std::filesystem::remove(path);
+}
+
+#if !defined(_WIN32)
+TEST_CASE("FlightRecorderSink: records logged right before an abort are recovered") {
+    const auto directory = std::filesystem::temp_directory_path() / "lm_flight_abort_test";
+    std::filesystem::remove_all(directory);
+    constexpr int Total = 500;
+
+    // The child logs through the async loggers and dies with their queues still full
+    const pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        const rlimit noCore{ 0, 0 };
+        setrlimit(RLIMIT_CORE, &noCore);
+        std::signal(SIGABRT, SIG_DFL);      // Not doctest's crash report
+        if (!std::freopen("/dev/null", "w", stdout))
+            std::_Exit(1);
+
+        LogConfig config;
+        config.LogsDirectory = directory.string();
+        config.FlightRecorderBytes = 256 * 1024;
+        config.SettingsFile.clear();
+        Log::Init("FlightAbort", config);
+        for (int i = 0; i < Total; ++i)
+            LM_CORE_LOG_INFO("record {}", i);
+        LM_LOG_FAST_ERROR(Core, "deferred record {}", Total);
+        LM_LOG_CRITICAL("about to abort");
+        std::abort();
+    }
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFSIGNALED(status));
+    CHECK(WTERMSIG(status) == SIGABRT);
+
+    FlightRecording recording;
+    std::string error;
+    REQUIRE_MESSAGE(RecoverFlightRecording(directory / "FlightAbort.flight", recording, error), error);
+    CHECK(recording.LostRecords == 0);
+    REQUIRE(recording.Records.size() >= Total + 2);
+
+    const auto endsWith = [](const std::string& text, const std::string& suffix) {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+    const auto& records = recording.Records;
+    CHECK(endsWith(records.back().Text, "about to abort\n"));
+    CHECK(records.back().Level == LogLevel::Critical);
+    CHECK(endsWith(records[records.size() - 2].Text, "[Core] deferred record " + std::to_string(Total) + "\n"));
+    const size_t first = records.size() - 2 - Total;
+    for (int i = 0; i < Total; ++i)
+        CHECK(endsWith(records[first + i].Text, "record " + std::to_string(i) + "\n"));
+
+    std::filesystem::remove_all(directory);
+}
+#endif
@@ -0,0 +1,261 @@
+#include <doctest/doctest.h>
+
+#include "Core/Logging/Gzip.h"
+#include "Core/Logging/JsonLinesSink.h"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/logger.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Limitless::Logging;
+
+namespace {
+    nlohmann::json FormatToJson(std::string_view payload, spdlog::level::level_enum level = spdlog::level::info) {
+        spdlog::details::log_msg msg(spdlog::source_loc{ "Renderer.cpp", 42, "" }, "LimitlessCore", level, payload);
+        spdlog::memory_buf_t out;
+        JsonLinesSink::FormatRecord(msg, out);
+        std::string line(out.data(), out.size());
+        REQUIRE(line.back() == '\n');
+        return nlohmann::json::parse(line);
+    }
+
+    // Independent inflater for the round-trip test: gzip member with stored and fixed-Huffman blocks only
+    // (all GzipCompress writes), checking the CRC and size trailer. Returns nullopt on any malformed input.
+    class TestInflater {
+    public:
+        explicit TestInflater(const std::vector<uint8_t>& gzip) : m_In(gzip) {}
+
+        std::optional<std::vector<uint8_t>> Inflate() {
+            if (m_In.size() < 18 || m_In[0] != 0x1F || m_In[1] != 0x8B || m_In[2] != 8 || m_In[3] != 0)
+                return std::nullopt;
+            m_Bit = 10 * 8;
+
+            bool last = false;
+            while (!last && m_Ok) {
+                last = Bits(1) != 0;
+                const uint32_t type = Bits(2);
+                if (type == 0 ? !Stored() : type == 1 ? !Fixed() : true)
+                    return std::nullopt;
+            }
+
+            size_t trailer = (m_Bit + 7) / 8;
+            if (!m_Ok || trailer + 8 != m_In.size())
+                return std::nullopt;
+            auto word = [&](size_t at) { return m_In[at] | (m_In[at + 1] << 8) | (m_In[at + 2] << 16) | (uint32_t(m_In[at + 3]) << 24); };
+            if (word(trailer) != Crc32(std::as_bytes(std::span(m_Out))) || word(trailer + 4) != uint32_t(m_Out.size()))
+                return std::nullopt;
+            return m_Out;
+        }
+
+    private:
+        uint32_t Bits(int count) {
+            uint32_t value = 0;
+            for (int i = 0; i < count; ++i, ++m_Bit) {
+                if (m_Bit / 8 >= m_In.size()) {
+                    m_Ok = false;
+                    return 0;
+                }
+                value |= uint32_t((m_In[m_Bit / 8] >> (m_Bit % 8)) & 1) << i;
+            }
+            return value;
+        }
+
+        // Huffman codes are packed most significant bit first
+        uint32_t Code(int count) {
+            uint32_t code = 0;
+            for (int i = 0; i < count; ++i)
+                code = (code << 1) | Bits(1);
+            return code;
+        }
+
+        bool Stored() {
+            m_Bit = (m_Bit + 7) / 8 * 8;
+            const uint32_t length = Bits(16);
+            if ((Bits(16) ^ 0xFFFF) != length)
+                return false;
+            for (uint32_t i = 0; i < length && m_Ok; ++i)
+                m_Out.push_back(uint8_t(Bits(8)));
+            return m_Ok;
+        }
+
+        uint32_t FixedLiteralLength() {
+            uint32_t code = Code(7);
+            if (code <= 23)
+                return 256 + code;
+            code = (code << 1) | Bits(1);
+            if (code >= 0x30 && code <= 0xBF)
+                return code - 0x30;
+            if (code >= 0xC0 && code <= 0xC7)
+                return 280 + code - 0xC0;
+            return 144 + ((code << 1) | Bits(1)) - 0x190;
+        }
+
+        bool Fixed() {
+            static constexpr uint16_t LengthBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+            static constexpr uint8_t LengthExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                       3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+            static constexpr uint16_t DistanceBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                         257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                         8193, 12289, 16385, 24577 };
+
+            for (;;) {
+                const uint32_t symbol = FixedLiteralLength();
+                if (!m_Ok || symbol > 285)
+                    return false;
+                if (symbol < 256) {
+                    m_Out.push_back(uint8_t(symbol));
+                    continue;
+                }
+                if (symbol == 256)
+                    return true;
+
+                const uint32_t length = LengthBase[symbol - 257] + Bits(LengthExtra[symbol - 257]);
+                const uint32_t distanceCode = Code(5);
+                if (distanceCode >= 30)
+                    return false;
+                const int extra = distanceCode < 4 ? 0 : int(distanceCode / 2 - 1);
+                const uint32_t distance = DistanceBase[distanceCode] + Bits(extra);
+                if (!m_Ok || distance > m_Out.size())
+                    return false;
+                for (uint32_t i = 0; i < length; ++i)
+                    m_Out.push_back(m_Out[m_Out.size() - distance]);
+            }
+        }
+
+        const std::vector<uint8_t>& m_In;
+        std::vector<uint8_t> m_Out;
+        size_t m_Bit = 0;
+        bool m_Ok = true;
+    };
+}
+
+TEST_CASE("JsonLinesSink: records carry category, message and typed fields") {
+    auto record = FormatToJson("[Renderer] Swapchain \"recreated\" | width=1920 scale=1.5 vsync=true path=\"C:/My Games\" id=0x1F");
+
+    CHECK(record["level"] == "info");
+    CHECK(record["logger"] == "LimitlessCore");
+    CHECK(record["category"] == "Renderer");
+    CHECK(record["msg"] == "Swapchain \"recreated\"");
+    CHECK(record["fields"]["width"] == 1920);
+    CHECK(record["fields"]["scale"] == 1.5);
+    CHECK(record["fields"]["vsync"] == true);
+    CHECK(record["fields"]["path"] == "C:/My Games");
+    CHECK(record["fields"]["id"] == "0x1F");
+    CHECK(record["file"] == "Renderer.cpp");
+    CHECK(record["line"] == 42);
+
+    const std::string timestamp = record["ts"];
+    CHECK(timestamp.size() == std::string_view("2026-01-02T03:04:05.678901Z").size());
+    CHECK(timestamp.back() == 'Z');
+}
+
+TEST_CASE("JsonLinesSink: plain messages stay whole") {
+    auto record = FormatToJson("a | b has no fields\n\tline two", spdlog::level::err);
+    CHECK(record["level"] == "error");
+    CHECK(record["msg"] == "a | b has no fields\n\tline two");
+    CHECK_FALSE(record.contains("category"));
+    CHECK_FALSE(record.contains("fields"));
+
+    CHECK(FormatToJson("[NotACategory] x")["msg"] == "[NotACategory] x");
+}
+
+TEST_CASE("JsonLinesSink: rotated files are compressed and pruned in the background") {
+    const auto directory = std::filesystem::temp_directory_path() / "lm_json_sink_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    {
+        JsonLinesSink::Config config;
+        config.File = directory / "Game.jsonl";
+        config.MaxFileSizeBytes = 2048;
+        config.MaxRotatedFiles = 2;
+        auto sink = std::make_shared<JsonLinesSink>(config);
+
+        spdlog::logger logger("json", sink);
+        for (int i = 0; i < 200; ++i)
+            logger.info("[Assets] loaded | index={}", i);
+        logger.flush();
+        sink->WaitForMaintenance();
+    }
+
+    int active = 0, compressed = 0, other = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        const std::string name = entry.path().filename().string();
+        if (name == "Game.jsonl") {
+            ++active;
+        } else if (name.ends_with(".jsonl.gz")) {
+            ++compressed;
+            std::ifstream file(entry.path(), std::ios::binary);
+            unsigned char magic[2]{};
+            file.read(reinterpret_cast<char*>(magic), 2);
+            CHECK(magic[0] == 0x1F);
+            CHECK(magic[1] == 0x8B);
+        } else {
+            ++other;
+        }
+    }
+    CHECK(active == 1);
+    CHECK(compressed == 2);
+    CHECK(other == 0);
+    CHECK(std::filesystem::file_size(directory / "Game.jsonl") <= 2048);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Gzip: CRC-32 and empty input") {
+    constexpr std::string_view check = "123456789";
+    CHECK(Crc32(std::as_bytes(std::span(check.data(), check.size()))) == 0xCBF43926u);
+
+    auto empty = GzipCompress({});
+    REQUIRE(empty.size() == 20);
+    CHECK(empty[0] == 0x1F);
+    CHECK(empty[1] == 0x8B);
+}
+
+TEST_CASE("Gzip: long matches and far distances round-trip") {
+    // Pseudo-random bytes only compress where the input repeats itself
+    uint32_t state = 12345;
+    auto randomBytes = [&state](size_t count) {
+        std::vector<uint8_t> bytes(count);
+        for (auto& byte : bytes) {
+            state = state * 1664525u + 1013904223u;
+            byte = uint8_t(state >> 24);
+        }
+        return bytes;
+    };
+    std::vector<uint8_t> input;
+    auto append = [&input](const std::vector<uint8_t>& bytes) { input.insert(input.end(), bytes.begin(), bytes.end()); };
+
+    input.assign(1000, 'a');                                        // Run: one literal, then overlapping max-length matches
+    const auto block = randomBytes(2000);
+    append(block);
+    append(block);                                                  // 2000-byte repeat, longer than any single match
+    const auto far = randomBytes(600);
+    append(far);
+    append(randomBytes(32767 - far.size()));
+    append(far);                                                    // Distance 32767, the largest the window allows
+    append(randomBytes(32768 - far.size()));
+    append(far);                                                    // Distance 32768: just outside the encoder's window
+    const std::string text = "2026-10-17 [info] frame presented in 16.6 ms\n";
+    for (int i = 0; i < 500; ++i)
+        input.insert(input.end(), text.begin(), text.end());
+
+    auto compressed = GzipCompress(std::as_bytes(std::span(input)));
+    auto decoded = TestInflater(compressed).Inflate();
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->size() == input.size());
+    CHECK(*decoded == input);
+
+    // The inflater is strict enough to notice a damaged stream
+    compressed[compressed.size() / 2] ^= 0x10;
+    CHECK_FALSE(TestInflater(compressed).Inflate().has_value());
+}
@@ -0,0 +1,90 @@
+#include <doctest/doctest.h>
+
+#include "Core/Logging/LogSettings.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace Limitless;
+using namespace Limitless::Logging;
+
+TEST_CASE("LogSettings: a full document parses into overrides") {
+    constexpr const char* json = R"({
+        "level": "warning",
+        "suppress_duplicates": false,
+        "loggers": {
+            "core":   { "level": "trace", "sinks": ["file", "flight"] },
+            "client": { "level": "error" }
+        },
+        "categories": { "*": "info", "Renderer": "trace", "Audio": "off" },
+        "sinks": { "console": { "level": "warn", "pattern": "%v" }, "file": {} }
+    })";
+
+    LogSettings settings;
+    std::string error;
+    REQUIRE_MESSAGE(ParseLogSettings(json, settings, error), error);
+
+    CHECK(settings.Level == LogLevel::Warn);
+    CHECK(settings.SuppressDuplicates == false);
+    CHECK(settings.Core.Level == LogLevel::Trace);
+    REQUIRE(settings.Core.Sinks.has_value());
+    CHECK(*settings.Core.Sinks == std::vector<std::string>{ "file", "flight" });
+    CHECK(settings.Client.Level == LogLevel::Error);
+    CHECK_FALSE(settings.Client.Sinks.has_value());
+    CHECK(settings.DefaultCategoryLevel == LogLevel::Info);
+    CHECK(settings.Categories[static_cast<size_t>(LogCategory::Renderer)] == LogLevel::Trace);
+    CHECK(settings.Categories[static_cast<size_t>(LogCategory::Audio)] == LogLevel::Off);
+    CHECK_FALSE(settings.Categories[static_cast<size_t>(LogCategory::Memory)].has_value());
+    REQUIRE(settings.Sinks.size() == 2);
+    CHECK(settings.Sinks["console"].Level == LogLevel::Warn);
+    CHECK(settings.Sinks["console"].Pattern == "%v");
+    CHECK_FALSE(settings.Sinks["file"].Pattern.has_value());
+}
+
+TEST_CASE("LogSettings: mistakes are rejected without touching the current settings") {
+    LogSettings settings;
+    settings.Level = LogLevel::Debug;
+    std::string error;
+
+    for (const char* json : {
+             R"({ "level": "verbose" })",
+             R"({ "categorys": {} })",
+             R"({ "categories": { "Render": "trace" } })",
+             R"({ "loggers": { "game": {} } })",
+             R"({ "loggers": { "core": { "sinks": "file" } } })",
+             R"({ "sinks": { "console": { "pattern": 5 } } })",
+             R"({ "suppress_duplicates": "yes" })",
+             R"([ "level", "info" ])",
+             R"({ "level": "info", )" }) {
+        CAPTURE(json);
+        error.clear();
+        CHECK_FALSE(ParseLogSettings(json, settings, error));
+        CHECK(!error.empty());
+    }
+    CHECK(settings.Level == LogLevel::Debug);
+}
+
+TEST_CASE("LogSettings: category levels are applied and restored") {
+    const auto path = std::filesystem::temp_directory_path() / "lm_logging_test.json";
+    {
+        std::ofstream file(path);
+        file << R"({ "categories": { "*": "error", "Renderer": "trace" } })";
+    }
+
+    LogSettings settings;
+    std::string error;
+    REQUIRE_MESSAGE(LoadLogSettings(path, settings, error), error);
+    REQUIRE(Log::ApplySettings(settings, error));
+    CHECK(Log::GetCategoryLevel(LogCategory::Renderer) == LogLevel::Trace);
+    CHECK(Log::GetCategoryLevel(LogCategory::Assets) == LogLevel::Error);
+    CHECK_FALSE(Log::IsCategoryEnabled(LogCategory::Assets, LogLevel::Warn));
+
+    // Empty settings return everything to the defaults
+    REQUIRE(Log::ApplySettings(LogSettings{}, error));
+    CHECK(Log::GetCategoryLevel(LogCategory::Assets) == LogLevel::Trace);
+    CHECK_FALSE(Log::GetSuppressDuplicates());  // Off without Init's reporter to flush repeats
+
+    std::filesystem::remove(path);
+    CHECK_FALSE(LoadLogSettings(path, settings, error));
+}
@@ -0,0 +1,87 @@
+#include <doctest/doctest.h>
+
+#include "Core/Memory/FrameAllocator.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Memory;
+
+TEST_CASE("FrameAllocator: allocations are aligned and recycled when their buffer comes round") {
+    auto& frames = FrameAllocator::Get();
+    frames.BeginFrame();
+
+    auto* first = static_cast<std::byte*>(frames.Allocate(64));
+    std::memset(first, 0x5A, 64);
+    for (size_t alignment : { 1, 8, 16, 64, 256 }) {
+        void* pointer = frames.Allocate(24, alignment);
+        CHECK(reinterpret_cast<uintptr_t>(pointer) % alignment == 0);
+    }
+
+    // Still readable while the next frame runs
+    frames.BeginFrame();
+    CHECK(first[0] == std::byte(0x5A));
+    CHECK(first[63] == std::byte(0x5A));
+
+    for (uint32_t i = 1; i < frames.GetBufferCount(); ++i)
+        frames.BeginFrame();
+    CHECK(frames.Allocate(64) == first);
+}
+
+TEST_CASE("FrameAllocator: overflow pages cover a spike and the arena grows to fit it") {
+    auto& frames = FrameAllocator::Get();
+    frames.BeginFrame();
+
+    const size_t spike = frames.GetArenaSize() * 3;
+    for (size_t used = 0; used < spike; used += 4096)
+        std::memset(frames.Allocate(4096), 1, 4096);
+
+    frames.BeginFrame();
+    auto stats = frames.GetStats();
+    CHECK(stats.LastFrameOverflowPages > 0);
+    CHECK(stats.LastFrameBytes >= spike);
+    CHECK(stats.HighWater >= spike);
+
+    // Same buffer again: the arena was regrown at reset, so the spike no longer overflows
+    for (uint32_t i = 1; i < frames.GetBufferCount(); ++i)
+        frames.BeginFrame();
+    for (size_t used = 0; used < spike; used += 4096)
+        frames.Allocate(4096);
+    frames.BeginFrame();
+    CHECK(frames.GetStats().LastFrameOverflowPages == 0);
+}
+
+TEST_CASE("FrameAllocator: threads bump their own arenas and pmr containers work") {
+    auto& frames = FrameAllocator::Get();
+    frames.BeginFrame();
+
+    constexpr int Threads = 4;
+    constexpr int Allocations = 2000;
+    std::vector<std::vector<uint32_t*>> blocks(Threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < Allocations; ++i) {
+                auto values = frames.NewArray<uint32_t>(8);
+                for (auto& value : values)
+                    value = static_cast<uint32_t>(t * Allocations + i);
+                blocks[t].push_back(values.data());
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    bool intact = true;
+    for (int t = 0; t < Threads; ++t)
+        for (int i = 0; i < Allocations; ++i)
+            for (int k = 0; k < 8; ++k)
+                intact &= blocks[t][i][k] == static_cast<uint32_t>(t * Allocations + i);
+    CHECK(intact);
+
+    std::pmr::vector<int> scratch(frames.GetResource());
+    for (int i = 0; i < 1000; ++i)
+        scratch.push_back(i);
+    CHECK(scratch.back() == 999);
+}
@@ -0,0 +1,67 @@
+#include <doctest/doctest.h>
+
+#include "Core/Memory/MemoryTracker.h"
+
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <thread>
+
+using namespace Limitless::Memory;
+
+TEST_CASE("MemoryTracker: tag scopes nest and restore") {
+    CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Untagged);
+    {
+        LM_MEMTAG(Renderer);
+        CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Renderer);
+        {
+            LM_MEMTAG(Assets);
+            CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Assets);
+        }
+        CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Renderer);
+    }
+    CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Untagged);
+}
+
+TEST_CASE("MemoryTracker: counters, peaks, per-frame counts and snapshot") {
+    const auto before = MemoryTracker::GetStats(MemoryTag::Audio);
+
+    MemoryTracker::RecordAllocation(MemoryTag::Audio, 1000);
+    MemoryTracker::RecordAllocation(MemoryTag::Audio, 500);
+    MemoryTracker::RecordFree(MemoryTag::Audio, 1000);
+
+    auto stats = MemoryTracker::GetStats(MemoryTag::Audio);
+    CHECK(stats.LiveBytes - before.LiveBytes == 500);
+    CHECK(stats.TotalAllocations - before.TotalAllocations == 2);
+    CHECK(stats.PeakBytes >= before.LiveBytes + 1500);
+
+    MemoryTracker::SetBudget(MemoryTag::Audio, 100);
+    MemoryTracker::BeginFrame(); // Over budget: logs a warning once
+    CHECK(MemoryTracker::GetStats(MemoryTag::Audio).FrameAllocations >= 2);
+    CHECK(MemoryTracker::GetStats(MemoryTag::Audio).Budget == 100);
+
+    auto snapshot = MemoryTracker::Snapshot();
+    CHECK(snapshot["tags"]["Audio"]["live_bytes"].get<size_t>() == stats.LiveBytes);
+    CHECK(snapshot["tags"]["Audio"]["budget_bytes"].get<size_t>() == 100);
+    CHECK(snapshot["global_override"].get<bool>() == MemoryTracker::IsGlobalOverrideEnabled());
+
+    MemoryTracker::RecordFree(MemoryTag::Audio, 500);
+    MemoryTracker::SetBudget(MemoryTag::Audio, 0);
+}
+
+TEST_CASE("MemoryTracker: global new is charged to the current tag") {
+    if (!MemoryTracker::IsGlobalOverrideEnabled())
+        return;
+
+    const size_t before = MemoryTracker::GetStats(MemoryTag::Gameplay).LiveBytes;
+    std::unique_ptr<char[]> block;
+    {
+        LM_MEMTAG(Gameplay);
+        block = std::make_unique<char[]>(4096);
+    }
+    CHECK(MemoryTracker::GetStats(MemoryTag::Gameplay).LiveBytes >= before + 4096);
+
+    // Freed on another thread, still credited back to the tag it was charged to
+    std::thread([&block]() { block.reset(); }).join();
+    CHECK(MemoryTracker::GetStats(MemoryTag::Gameplay).LiveBytes == before);
+}
@@ -0,0 +1,89 @@
+#include <doctest/doctest.h>
+
+#include "Core/Memory/TLSFResource.h"
+
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Limitless::Memory;
+
+TEST_CASE("TLSFResource: allocations are aligned and coalesce back into one block") {
+    TLSFResource heap(64 * 1024);
+
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t alignment : { 8, 16, 32, 64, 256, 4096 }) {
+        void* pointer = heap.allocate(100, alignment);
+        CHECK(reinterpret_cast<uintptr_t>(pointer) % alignment == 0);
+        blocks.emplace_back(pointer, alignment);
+    }
+    CHECK(heap.CheckIntegrity());
+
+    for (auto& [pointer, alignment] : blocks)
+        heap.deallocate(pointer, 100, alignment);
+    CHECK(heap.CheckIntegrity());
+    CHECK(heap.GetStats().Allocations == 0);
+    CHECK(heap.GetStats().UsedBytes == 0);
+
+    // Everything merged back, so a near-pool-sized block fits without growing
+    void* big = heap.allocate(60 * 1024);
+    CHECK(heap.GetStats().PoolCount == 1);
+    heap.deallocate(big, 60 * 1024);
+}
+
+TEST_CASE("TLSFResource: random workload keeps contents and invariants, growing pools on demand") {
+    TLSFResource heap(256 * 1024);
+    std::mt19937 random(1234);
+    std::vector<std::pair<unsigned char*, size_t>> live;
+
+    bool intact = true;
+    for (int step = 0; step < 20000; ++step) {
+        if (live.empty() || random() % 3 != 0) {
+            size_t size = 1 + random() % (random() % 8 == 0 ? 64 * 1024 : 512);
+            auto* bytes = static_cast<unsigned char*>(heap.allocate(size));
+            std::memset(bytes, static_cast<int>(size & 0xFF), size);
+            live.emplace_back(bytes, size);
+        } else {
+            size_t index = random() % live.size();
+            auto [bytes, size] = live[index];
+            intact &= bytes[0] == static_cast<unsigned char>(size & 0xFF);
+            intact &= bytes[size - 1] == static_cast<unsigned char>(size & 0xFF);
+            heap.deallocate(bytes, size);
+            live[index] = live.back();
+            live.pop_back();
+        }
+        if (step % 1000 == 0)
+            intact &= heap.CheckIntegrity();
+    }
+    CHECK(intact);
+    CHECK(heap.GetStats().PoolCount > 1);
+
+    for (auto& [bytes, size] : live)
+        heap.deallocate(bytes, size);
+    CHECK(heap.CheckIntegrity());
+    CHECK(heap.GetStats().UsedBytes == 0);
+}
+
+TEST_CASE("TLSFResource: backs pmr containers, optionally shared between threads") {
+    TLSFResource heap(128 * 1024, true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&heap, t]() {
+            std::pmr::map<int, std::pmr::string> names(&heap);
+            for (int i = 0; i < 2000; ++i)
+                names.emplace(i, std::pmr::string("entry number " + std::to_string(i * t), &heap));
+            std::pmr::vector<int> values(&heap);
+            for (int i = 0; i < 10000; ++i)
+                values.push_back(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(heap.CheckIntegrity());
+    CHECK(heap.GetStats().Allocations == 0);
+}
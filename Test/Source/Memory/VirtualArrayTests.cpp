@@ -0,0 +1,65 @@
+#include <doctest/doctest.h>
+
+#include "Core/Memory/VirtualArray.h"
+
+#include <stdexcept>
+#include <string>
+
+using namespace Limitless::Memory;
+
+TEST_CASE("VirtualArray: growth commits pages in place and never moves elements") {
+    VirtualArray<uint64_t> array(10'000'000);
+    CHECK(array.GetCommittedBytes() == 0);
+
+    array.PushBack(42);
+    uint64_t* first = &array[0];
+    for (uint64_t i = 1; i < 1'000'000; ++i)
+        array.PushBack(i);
+
+    CHECK(&array[0] == first);
+    CHECK(*first == 42);
+    CHECK(array.Size() == 1'000'000);
+    CHECK(array.Back() == 999'999);
+    CHECK(array.GetCommittedBytes() >= array.Size() * sizeof(uint64_t));
+    CHECK(array.GetCommittedBytes() < array.MaxSize() * sizeof(uint64_t));
+
+    array.Resize(10);
+    array.ShrinkToFit();
+    CHECK(array.GetCommittedBytes() == VirtualMemory::GetPageSize());
+    CHECK(array[9] == 9);
+
+    // Decommitted pages come back zeroed when recommitted
+    array.Resize(100'000);
+    CHECK(array[50'000] == 0);
+}
+
+TEST_CASE("VirtualArray: non-trivial elements are constructed and destroyed") {
+    VirtualArray<std::string> names(1000);
+    for (int i = 0; i < 1000; ++i)
+        names.EmplaceBack("name " + std::to_string(i));
+    CHECK(names[999] == "name 999");
+
+    CHECK_THROWS_AS(names.EmplaceBack("one too many"), std::runtime_error);
+    CHECK(names.Size() == 1000);
+
+    names.PopBack();
+    CHECK(names.Back() == "name 998");
+
+    VirtualArray<std::string> moved(std::move(names));
+    CHECK(moved.Size() == 999);
+    CHECK(names.Empty());
+}
+
+TEST_CASE("VirtualArray: huge page mode aligns the reservation") {
+    VirtualArray<float> samples(64 * 1024 * 1024, true);
+    samples.Resize(1024 * 1024);
+    CHECK(reinterpret_cast<uintptr_t>(samples.Data()) % VirtualMemory::GetHugePageSize() == 0);
+    CHECK(samples.GetCommittedBytes() % VirtualMemory::GetHugePageSize() == 0);
+
+    float sum = 0.0f;
+    for (float& sample : samples) {
+        sample = 1.0f;
+        sum += sample;
+    }
+    CHECK(sum == doctest::Approx(1024.0 * 1024.0));
+}
@@ -33,6 +33,7 @@ project "Test"
 
     includedirs
     {
+        "Source",   -- Shared test helpers, e.g. "CapturedLog.h"
         "%{wks.location}/Engine/Source",
         "%{wks.location}/Engine/Vendor/doctest",
         "%{wks.location}/Engine/Vendor/spdlog",
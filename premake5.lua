@@ -1,3 +1,9 @@
+newoption
+{
+    trigger = "memory-tracking",
+    description = "Track heap allocations per MemoryTag in Release builds (always on in Debug)"
+}
+
 workspace "Limitless"
     startproject "Sandbox"
 
@@ -60,4 +66,6 @@ include "Engine/Vendor/imgui/premake5.lua"
 group ""
 include "Engine"
 include "Sandbox"
-include "Test"
\ No newline at end of file
+include "Test"
+include "Benchmark"
+include "LogTools"
\ No newline at end of file